@@ -41,6 +41,7 @@ if test "$PHP_CASSANDRA" != "no"; then
     src/BatchStatement.c \
     src/Bigint.c \
     src/Blob.c \
+    src/BoundStatement.c \
     src/Cluster.c \
     src/Cluster/Builder.c \
     src/Collection.c \
@@ -59,6 +60,7 @@ if test "$PHP_CASSANDRA" != "no"; then
     src/DefaultSession.c \
     src/DefaultTable.c \
     src/Duration.c \
+    src/EventLoop.c \
     src/Exception.c \
     src/ExecutionOptions.c \
     src/Float.c \
@@ -69,6 +71,7 @@ if test "$PHP_CASSANDRA" != "no"; then
     src/FutureRows.c \
     src/FutureSession.c \
     src/FutureValue.c \
+    src/Futures.c \
     src/Index.c \
     src/Inet.c \
     src/Keyspace.c \
@@ -77,7 +80,10 @@ if test "$PHP_CASSANDRA" != "no"; then
     src/Numeric.c \
     src/PreparedStatement.c \
     src/RetryPolicy.c \
+    src/Row.c \
+    src/RowStream.c \
     src/Rows.c \
+    src/Scheduler.c \
     src/Schema.c \
     src/Session.c \
     src/Set.c \
@@ -148,6 +154,7 @@ if test "$PHP_CASSANDRA" != "no"; then
   ";
 
   CASSANDRA_UTIL="\
+    util/bind.c \
     util/bytes.c \
     util/collections.c \
     util/consistency.c \
@@ -155,6 +162,7 @@ if test "$PHP_CASSANDRA" != "no"; then
     util/hash.c \
     util/inet.c \
     util/math.c \
+    util/prepared_cache.c \
     util/ref.c \
     util/result.c \
     util/types.c \
@@ -161,6 +161,44 @@ final class Cassandra {
      */
     const BATCH_COUNTER = 2;
 
+    /**
+     * Rows are arrays indexed by column names (default).
+     *
+     * @see Session::execute()
+     */
+    const FETCH_ASSOC = 0;
+
+    /**
+     * Rows are arrays indexed by column positions.
+     *
+     * @see Session::execute()
+     */
+    const FETCH_NUM = 1;
+
+    /**
+     * Rows are the value of a single column, selected with the
+     * `fetch_column` execution option.
+     *
+     * @see Session::execute()
+     */
+    const FETCH_COLUMN = 2;
+
+    /**
+     * The page is an array of the second column's values indexed by the
+     * values of the first column.
+     *
+     * @see Session::execute()
+     */
+    const FETCH_KEY_PAIR = 3;
+
+    /**
+     * The page is an array indexed by the values of the first column, each
+     * entry lists the rows (without the first column) sharing that value.
+     *
+     * @see Session::execute()
+     */
+    const FETCH_GROUP = 4;
+
     /**
      * Used to disable logging.
      */
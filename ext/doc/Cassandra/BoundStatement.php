@@ -0,0 +1,47 @@
+<?php
+
+/**
+ * Copyright 2017 DataStax, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+namespace Cassandra;
+
+/**
+ * A prepared statement bound to its arguments, which can be executed
+ * repeatedly. Changing an argument only binds the new value, the other
+ * arguments are kept as they were bound.
+ *
+ * Arguments given in the execution options of a bound statement are only
+ * used for that execution.
+ *
+ * @see PreparedStatement::bind()
+ */
+final class BoundStatement implements Statement {
+
+    private function __construct() { }
+
+    /**
+     * Binds a value to a parameter of this statement.
+     *
+     * @param int|string $key position or name of the parameter
+     * @param mixed $value value to bind
+     *
+     * @throws Exception\InvalidArgumentException
+     *
+     * @return \Cassandra\BoundStatement self
+     */
+    public function set($key, $value) { }
+
+}
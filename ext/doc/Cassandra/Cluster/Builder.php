@@ -54,6 +54,8 @@ final class Builder {
     /**
      * Configures default timeout for future resolution in blocking operations
      * Set to null to disable (default).
+     * It's also the request timeout of executions that don't use an execution
+     * profile, the request timeout of a profile applies otherwise.
      *
      * @param float|null $timeout Timeout value in seconds, can be fractional
      *
@@ -61,6 +63,35 @@ final class Builder {
      */
     public function withDefaultTimeout($timeout) { }
 
+    /**
+     * Decode bigint, counter, smallint, tinyint, timestamp, date, time and
+     * float values as PHP integers and floats, and uuid, timeuuid and inet
+     * values as strings, instead of their wrapper objects. This becomes the
+     * default of every session and can be overridden with the
+     * `native_types` execution option.
+     *
+     * @param bool $enabled Whether to decode results as native types (optional)
+     *
+     * @return \Cassandra\Cluster\Builder self
+     */
+    public function withNativeTypes($enabled) { }
+
+    /**
+     * Prepare the queries of simple statements executed at least `threshold`
+     * times and execute them as prepared statements from then on. Queries
+     * are prepared in the background and executed unprepared until then.
+     * Queries that include their values are better bound with arguments so
+     * that they can be prepared once. Prepared queries are kept in the
+     * session's cache, up to `cassandra.prepared_cache_size` of them.
+     *
+     * @param int|null $threshold Executions before a query is prepared or null to disable
+     *
+     * @throws \Exception\InvalidArgumentException
+     *
+     * @return \Cassandra\Cluster\Builder self
+     */
+    public function withAutoPrepare($threshold) { }
+
     /**
      * Configures the initial endpoints. Note that the driver will
      * automatically discover and connect to the rest of the cluster.
@@ -302,6 +333,24 @@ final class Builder {
      */
     public function withTimestampGenerator($generator) { }
 
+    /**
+     * Registers an execution profile that executions select with the
+     * `profile` execution option. The profile's settings are resolved once
+     * by the driver instead of on every execution, and options given to an
+     * execution override them. Profiles support the `consistency`,
+     * `serial_consistency`, `timeout` and `retry_policy` execution options,
+     * and a `datacenter` option that routes the profile's requests to the
+     * hosts of that local datacenter first.
+     *
+     * @param string $name Name of the profile
+     * @param array $options Execution options of the profile
+     *
+     * @throws \Cassandra\Exception\InvalidArgumentException
+     *
+     * @return \Cassandra\Cluster\Builder self
+     */
+    public function withExecutionProfile($name, $options) { }
+
     /**
      * Enables/disables Schema Metadata.
      *
@@ -44,4 +44,22 @@ final class DefaultCluster implements Cluster {
      */
     public function connectAsync($keyspace) { }
 
+    /**
+     * Connects the persistent sessions of the given keyspaces and prepares
+     * their queries, unless the worker process did already. Sessions and
+     * prepared statements are then reused by later requests, so calling
+     * this at the start of every request only costs a lookup once the
+     * worker is warm. Keyspaces are the keys of the array, integer keys
+     * and empty names being sessions without a keyspace. Nothing is done
+     * when persistent sessions are disabled.
+     *
+     * @param array $keyspaces Queries to prepare, indexed by keyspace
+     * @param int|double|null $timeout Optional timeout for each connection and prepare
+     *
+     * @throws \Cassandra\Exception\InvalidArgumentException
+     *
+     * @return void
+     */
+    public function preload($keyspaces, $timeout) { }
+
 }
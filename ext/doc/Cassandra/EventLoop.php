@@ -0,0 +1,60 @@
+<?php
+
+/**
+ * Copyright 2017 DataStax, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+namespace Cassandra;
+
+/**
+ * Integrates the driver's futures with an event loop. The stream becomes
+ * readable when a watched future completes, the event loop then calls
+ * `drain()` to get the completed futures and resolve them without blocking.
+ *
+ * @see Future
+ */
+final class EventLoop {
+
+    private function __construct() { }
+
+    /**
+     * Returns a stream that becomes readable when watched futures complete,
+     * to be added to the event loop's read watchers. Not available on
+     * Windows.
+     *
+     * @throws Exception\RuntimeException
+     *
+     * @return resource A readable stream
+     */
+    public static function stream() { }
+
+    /**
+     * Signals the stream once the future completes
+     *
+     * @param \Cassandra\Future $future future to watch
+     *
+     * @return null Nothing
+     */
+    public static function watch($future) { }
+
+    /**
+     * Resets the stream and returns the watched futures that completed, they
+     * aren't watched anymore.
+     *
+     * @return array The completed futures
+     */
+    public static function drain() { }
+
+}
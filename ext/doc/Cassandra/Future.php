@@ -40,4 +40,13 @@ interface Future {
      */
     public function get($timeout);
 
+    /**
+     * Stops waiting for the result, `get()` throws afterwards. Only the
+     * futures of executions, FutureRows, can be cancelled, the others
+     * return false.
+     *
+     * @return bool Whether the future was cancelled, false once it has resolved
+     */
+    public function cancel();
+
 }
@@ -37,4 +37,28 @@ final class FutureRows implements Future {
      */
     public function get($timeout) { }
 
+    /**
+     * Same as `get()` but suspends the current fiber instead of blocking,
+     * the fiber is resumed by `Scheduler::run()` or `Scheduler::tick()` once
+     * the future resolves. Blocks like `get()` outside of fibers.
+     *
+     * @see Scheduler
+     *
+     * @param int|double|null $timeout A timeout in seconds
+     *
+     * @throws Exception\InvalidArgumentException
+     * @throws Exception\TimeoutException
+     *
+     * @return \Cassandra\Rows|null The result set
+     */
+    public function await($timeout) { }
+
+    /**
+     * Stops waiting for the result, `get()` throws afterwards. The request
+     * itself runs until it completes or its timeout elapses.
+     *
+     * @return bool Whether the future was cancelled, false once it has resolved
+     */
+    public function cancel() { }
+
 }
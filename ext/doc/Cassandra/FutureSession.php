@@ -37,4 +37,27 @@ final class FutureSession implements Future {
      */
     public function get($timeout) { }
 
+    /**
+     * Same as `get()` but suspends the current fiber instead of blocking,
+     * the fiber is resumed by `Scheduler::run()` or `Scheduler::tick()` once
+     * the future resolves. Blocks like `get()` outside of fibers.
+     *
+     * @see Scheduler
+     *
+     * @param int|double|null $timeout A timeout in seconds
+     *
+     * @throws Exception\InvalidArgumentException
+     * @throws Exception\TimeoutException
+     *
+     * @return \Cassandra\Session A connected session
+     */
+    public function await($timeout) { }
+
+    /**
+     * Connecting a session can't be cancelled.
+     *
+     * @return bool false
+     */
+    public function cancel() { }
+
 }
@@ -35,4 +35,11 @@ final class FutureValue implements Future {
      */
     public function get($timeout) { }
 
+    /**
+     * The value is resolved already.
+     *
+     * @return bool false
+     */
+    public function cancel() { }
+
 }
@@ -0,0 +1,72 @@
+<?php
+
+/**
+ * Copyright 2017 DataStax, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+namespace Cassandra;
+
+/**
+ * Waits on many futures at once. Futures are returned with their keys, in
+ * the order they are seen completing, so that results can be processed as
+ * soon as they arrive. Futures not created by the driver are considered
+ * complete.
+ *
+ * @see Future
+ */
+final class Futures {
+
+    private function __construct() { }
+
+    /**
+     * Waits for all the futures to complete.
+     *
+     * @param array $futures futures to wait on
+     * @param int|double|null $timeout A timeout in seconds
+     *
+     * @throws Exception\InvalidArgumentException
+     * @throws Exception\TimeoutException
+     *
+     * @return array All the futures, in the order they completed
+     */
+    public static function all($futures, $timeout) { }
+
+    /**
+     * Waits for one of the futures to complete.
+     *
+     * @param array $futures futures to wait on
+     * @param int|double|null $timeout A timeout in seconds
+     *
+     * @throws Exception\InvalidArgumentException
+     * @throws Exception\TimeoutException
+     *
+     * @return \Cassandra\Future The first future to complete
+     */
+    public static function any($futures, $timeout) { }
+
+    /**
+     * Waits for at least one of the futures to complete, without throwing
+     * when the timeout expires.
+     *
+     * @param array $futures futures to wait on
+     * @param int|double|null $timeout A timeout in seconds
+     *
+     * @throws Exception\InvalidArgumentException
+     *
+     * @return array The futures that completed, empty if none did within the timeout
+     */
+    public static function select($futures, $timeout) { }
+
+}
@@ -26,10 +26,29 @@ namespace Cassandra;
  * faster, because they are sent directly to replica nodes and avoid the extra
  * network hop.
  *
+ * Arguments of prepared statements are converted using the types of the
+ * statement's parameters, so native PHP values can be used where a value
+ * object would otherwise be required: integers for `bigint`, `counter`,
+ * `smallint`, `tinyint`, `varint`, `decimal`, `double`, `float` and
+ * `timestamp` (in milliseconds since the epoch), strings of 36 characters or of 16 bytes for
+ * `uuid` and `timeuuid`, numeric strings for `varint` and `decimal` and
+ * arrays for `list`, `set` and `map`.
+ *
  * @see Session::prepare()
  */
 final class PreparedStatement implements Statement {
 
     private function __construct() { }
 
+    /**
+     * Binds arguments to this statement ahead of its executions.
+     *
+     * @param array|null $arguments positional or named arguments (optional)
+     *
+     * @throws Exception\InvalidArgumentException
+     *
+     * @return \Cassandra\BoundStatement a statement bound to the arguments
+     */
+    public function bind($arguments) { }
+
 }
@@ -0,0 +1,119 @@
+<?php
+
+/**
+ * Copyright 2017 DataStax, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+namespace Cassandra;
+
+/**
+ * A single row of a result, returned by Rows when the `row_objects`
+ * execution option is enabled. Columns are only decoded the first time
+ * they are accessed.
+ */
+final class Row implements \Countable, \ArrayAccess {
+
+    /**
+     */
+    public function __construct() { }
+
+    /**
+     * Returns the number of columns.
+     *
+     * @return int number of columns
+     *
+     * @see \Countable::count()
+     */
+    public function count() { }
+
+    /**
+     * Decodes all the columns of the row.
+     *
+     * @return array the row as an array indexed by column names
+     */
+    public function toArray() { }
+
+    /**
+     * Returns existence of a given column.
+     *
+     * @param string|int $offset column name or position
+     *
+     * @return bool whether the column exists
+     *
+     * @see \ArrayAccess::offsetExists()
+     */
+    public function offsetExists($offset) { }
+
+    /**
+     * Returns the value of a given column.
+     *
+     * @param string|int $offset column name or position
+     *
+     * @throws Exception\InvalidArgumentException
+     *
+     * @return mixed value of the column
+     *
+     * @see \ArrayAccess::offsetGet()
+     */
+    public function offsetGet($offset) { }
+
+    /**
+     * Sets the value of a given column.
+     *
+     * @param string|int $offset column name or position
+     * @param mixed $value column value
+     *
+     * @throws Exception\DomainException
+     *
+     * @return void
+     *
+     * @see \ArrayAccess::offsetSet()
+     */
+    public function offsetSet($offset, $value) { }
+
+    /**
+     * Removes a given column.
+     *
+     * @param string|int $offset column name or position
+     *
+     * @throws Exception\DomainException
+     *
+     * @return void
+     *
+     * @see \ArrayAccess::offsetUnset()
+     */
+    public function offsetUnset($offset) { }
+
+    /**
+     * Returns the value of a given column.
+     *
+     * @param string $name column name
+     *
+     * @throws Exception\InvalidArgumentException
+     *
+     * @return mixed value of the column
+     */
+    public function __get($name) { }
+
+    /**
+     * Returns existence of a given column.
+     *
+     * @param string $name column name
+     *
+     * @return bool whether the column exists
+     */
+    public function __isset($name) { }
+
+}
@@ -0,0 +1,79 @@
+<?php
+
+/**
+ * Copyright 2017 DataStax, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+namespace Cassandra;
+
+/**
+ * A forward-only iterator over the rows of all the pages of a result,
+ * returned by Rows::stream(). Rows are numbered from 0 across pages.
+ */
+final class RowStream implements \Iterator {
+
+    /**
+     */
+    public function __construct() { }
+
+    /**
+     * Resets the stream to its first row.
+     *
+     * @throws Exception\LogicException once the stream moved past its first page
+     *
+     * @return void
+     *
+     * @see \Iterator::rewind()
+     */
+    public function rewind() { }
+
+    /**
+     * Returns the current row.
+     *
+     * @return mixed current row
+     *
+     * @see \Iterator::current()
+     */
+    public function current() { }
+
+    /**
+     * Returns the position of the current row across all pages.
+     *
+     * @return int current position
+     *
+     * @see \Iterator::key()
+     */
+    public function key() { }
+
+    /**
+     * Advances to the next row, waiting for the next page when the end of
+     * the current one is reached.
+     *
+     * @return void
+     *
+     * @see \Iterator::next()
+     */
+    public function next() { }
+
+    /**
+     * Returns existence of more rows.
+     *
+     * @return bool whether there are more rows
+     *
+     * @see \Iterator::valid()
+     */
+    public function valid() { }
+
+}
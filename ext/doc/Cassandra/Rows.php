@@ -55,9 +55,10 @@ final class Rows implements \Iterator, \ArrayAccess {
     public function current() { }
 
     /**
-     * Returns current index.
+     * Returns current index, or the value of the first column for pages
+     * fetched with Cassandra::FETCH_KEY_PAIR or Cassandra::FETCH_GROUP.
      *
-     * @return int index
+     * @return int|string index
      *
      * @see \Iterator::key()
      */
@@ -84,7 +85,7 @@ final class Rows implements \Iterator, \ArrayAccess {
     /**
      * Returns existence of a given row.
      *
-     * @param int $offset row index
+     * @param int|string $offset row index, or key of a page fetched with a keyed fetch style
      *
      * @return bool whether a row at a given index exists
      *
@@ -95,7 +96,7 @@ final class Rows implements \Iterator, \ArrayAccess {
     /**
      * Returns a row at given index.
      *
-     * @param int $offset row index
+     * @param int|string $offset row index, or key of a page fetched with a keyed fetch style
      *
      * @return array|null row at a given index
      *
@@ -153,6 +154,22 @@ final class Rows implements \Iterator, \ArrayAccess {
      */
     public function nextPageAsync() { }
 
+    /**
+     * Iterates over the rows of this page and all the following pages.
+     *
+     * When prefetching, the next page is requested as soon as a page
+     * arrives so that it's fetched while the rows of the current page are
+     * processed.
+     *
+     * @throws Exception\LogicException for the Cassandra::FETCH_KEY_PAIR and Cassandra::FETCH_GROUP fetch styles
+     *
+     * @param bool $prefetch request the next page ahead of time (default true)
+     * @param float|null $timeout max time in seconds to wait for each page (optional)
+     *
+     * @return \Cassandra\RowStream an iterator over the rows of all pages
+     */
+    public function stream($prefetch, $timeout) { }
+
     /**
      * Returns the raw paging state token.
      *
@@ -167,4 +184,17 @@ final class Rows implements \Iterator, \ArrayAccess {
      */
     public function first() { }
 
+    /**
+     * Get the rows of this page as one array of values per column, keyed by
+     * column name (or by column position for Cassandra::FETCH_NUM).
+     *
+     * With the `columnar` execution option the page is decoded straight into
+     * these arrays, without building an array for each row.
+     *
+     * @throws Exception\LogicException for the Cassandra::FETCH_COLUMN, Cassandra::FETCH_KEY_PAIR and Cassandra::FETCH_GROUP fetch styles
+     *
+     * @return array values of each column, in row order
+     */
+    public function columns() { }
+
 }
@@ -0,0 +1,54 @@
+<?php
+
+/**
+ * Copyright 2017 DataStax, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+namespace Cassandra;
+
+/**
+ * Resumes the fibers suspended by `await()` on the driver's futures. The
+ * driver's I/O threads only count completions, the fibers are resumed from
+ * the thread running PHP when `run()` or `tick()` are called.
+ *
+ * @see FutureRows::await()
+ * @see EventLoop
+ */
+final class Scheduler {
+
+    private function __construct() { }
+
+    /**
+     * Resumes fibers as their futures complete until none is awaiting a
+     * future anymore.
+     *
+     * @param int|double|null $timeout A timeout in seconds
+     *
+     * @throws Exception\InvalidArgumentException
+     *
+     * @return bool false if fibers are still awaiting when the timeout expires
+     */
+    public static function run($timeout) { }
+
+    /**
+     * Resumes the fibers whose futures completed or timed out without
+     * blocking, to be called by event loops when the `EventLoop` stream
+     * becomes readable.
+     *
+     * @return int The number of fibers resumed
+     */
+    public static function tick() { }
+
+}
@@ -40,6 +40,17 @@ interface Session {
      * | serial_consistency | int             | Either Dse::CONSISTENCY_SERIAL or Dse::CONSISTENCY_LOCAL_SERIAL                                          |
      * | timestamp          | int\|string     | Either an integer or integer string timestamp that represents the number of microseconds since the epoch |
      * | execute_as         | string          | User to execute statement as                                                                             |
+     * | lazy               | bool            | Decode rows on demand, when they are first accessed, instead of decoding the whole page up front         |
+     * | row_objects        | bool            | Return each row as a Row object whose columns are only decoded when they are accessed                    |
+     * | columns            | array           | Names of the columns to decode, the other columns of the result are skipped                              |
+     * | native_types       | bool            | Decode scalar columns as PHP integers, floats and strings instead of wrapper objects                     |
+     * | fetch_style        | int             | One of Cassandra::FETCH_* to choose the shape of the rows, defaults to Cassandra::FETCH_ASSOC            |
+     * | fetch_column       | int             | Position of the column returned by Cassandra::FETCH_COLUMN, defaults to 0                                |
+     * | columnar           | bool            | Decode the page one column at a time for Rows::columns() instead of one array per row                    |
+     * | concurrency        | int             | Maximum number of executions of DefaultSession::executeMany() in flight, defaults to 64                  |
+     * | callback           | callable        | Called with the rows or the exception of each execution of DefaultSession::executeMany() as it completes |
+     * | profile            | string          | Execution profile registered with Cluster\Builder::withExecutionProfile(), set options override it       |
+     * | deadline           | int\|double     | Seconds the execution may take including the pages fetched afterwards                                    |
      *
      * @param string|\Cassandra\Statement $statement string or statement to be executed.
      * @param array|\Cassandra\ExecutionOptions|null $options Options to control execution of the query.
@@ -19,9 +19,13 @@
 #include "php_driver_types.h"
 #include "version.h"
 
+#include "util/bind.h"
 #include "util/types.h"
+#include "util/future.h"
 #include "util/ref.h"
 
+#include "src/Scheduler.h"
+
 #include <php_ini.h>
 #include <ext/standard/info.h>
 
@@ -86,6 +90,7 @@ ZEND_GET_MODULE(php_driver)
 PHP_INI_BEGIN()
   PHP_DRIVER_INI_ENTRY_LOG
   PHP_DRIVER_INI_ENTRY_LOG_LEVEL
+  PHP_DRIVER_INI_ENTRY_PREPARED_CACHE_SIZE
 PHP_INI_END()
 
 static int le_php_driver_cluster_res;
@@ -120,6 +125,7 @@ php_driver_session_dtor(zend_resource *rsrc)
   if (psession) {
     cass_future_free(psession->future);
     php_driver_del_peref(&psession->session, 1);
+    php_driver_del_peref(&psession->prepared_cache, 1);
     pefree(psession, 1);
     PHP_DRIVER_G(persistent_sessions)--;
     rsrc->ptr = NULL;
@@ -406,6 +412,9 @@ static ZEND_GINIT_FUNCTION(php_driver)
   php_driver_globals->uuid_gen_pid        = 0;
   php_driver_globals->persistent_clusters = 0;
   php_driver_globals->persistent_sessions = 0;
+  PHP5TO7_ZVAL_UNDEF(php_driver_globals->watched_futures);
+  php_driver_globals->awaiting_fibers     = NULL;
+  php_driver_globals->released_futures    = NULL;
   PHP5TO7_ZVAL_UNDEF(php_driver_globals->type_varchar);
   PHP5TO7_ZVAL_UNDEF(php_driver_globals->type_text);
   PHP5TO7_ZVAL_UNDEF(php_driver_globals->type_blob);
@@ -507,6 +516,9 @@ PHP_MINIT_FUNCTION(php_driver)
   php_driver_define_FutureSession();
   php_driver_define_FutureValue();
   php_driver_define_FutureClose();
+  php_driver_define_Futures();
+  php_driver_define_EventLoop();
+  php_driver_define_Scheduler();
   php_driver_define_Session();
   php_driver_define_DefaultSession();
   php_driver_define_SSLOptions();
@@ -514,9 +526,12 @@ PHP_MINIT_FUNCTION(php_driver)
   php_driver_define_Statement();
   php_driver_define_SimpleStatement();
   php_driver_define_PreparedStatement();
+  php_driver_define_BoundStatement();
   php_driver_define_BatchStatement();
   php_driver_define_ExecutionOptions();
   php_driver_define_Rows();
+  php_driver_define_Row();
+  php_driver_define_RowStream();
 
   php_driver_define_Schema();
   php_driver_define_DefaultSchema();
@@ -554,6 +569,8 @@ PHP_MINIT_FUNCTION(php_driver)
   php_driver_define_TimestampGeneratorMonotonic();
   php_driver_define_TimestampGeneratorServerSide();
 
+  php_driver_bind_init();
+
   return SUCCESS;
 }
 
@@ -561,6 +578,8 @@ PHP_MSHUTDOWN_FUNCTION(php_driver)
 {
   /* UNREGISTER_INI_ENTRIES(); */
 
+  php_driver_bind_destroy();
+
   return SUCCESS;
 }
 
@@ -572,6 +591,10 @@ PHP_RINIT_FUNCTION(php_driver)
   PHP_DRIVER_SCALAR_TYPES_MAP(XX_SCALAR)
 #undef XX_SCALAR
 
+  PHP5TO7_ZVAL_UNDEF(PHP_DRIVER_G(watched_futures));
+  PHP_DRIVER_G(awaiting_fibers) = NULL;
+  PHP_DRIVER_G(released_futures) = NULL;
+
   return SUCCESS;
 }
 
@@ -583,6 +606,10 @@ PHP_RSHUTDOWN_FUNCTION(php_driver)
   PHP_DRIVER_SCALAR_TYPES_MAP(XX_SCALAR)
 #undef XX_SCALAR
 
+  PHP5TO7_ZVAL_MAYBE_DESTROY(PHP_DRIVER_G(watched_futures));
+  php_driver_scheduler_destroy(TSRMLS_C);
+  php_driver_future_destroy(TSRMLS_C);
+
   return SUCCESS;
 }
 
@@ -518,8 +518,11 @@ void throw_invalid_argument(zval *object,
 
 #define PHP_DRIVER_DEFAULT_CONSISTENCY CASS_CONSISTENCY_LOCAL_ONE
 
+#define PHP_DRIVER_DEFAULT_CONCURRENCY 64
+
 #define PHP_DRIVER_DEFAULT_LOG       PHP_DRIVER_NAME ".log"
 #define PHP_DRIVER_DEFAULT_LOG_LEVEL "ERROR"
+#define PHP_DRIVER_DEFAULT_PREPARED_CACHE_SIZE "1000"
 
 #define PHP_DRIVER_INI_ENTRY_LOG \
   PHP_INI_ENTRY(PHP_DRIVER_NAME ".log", PHP_DRIVER_DEFAULT_LOG, PHP_INI_ALL, OnUpdateLog)
@@ -527,7 +530,11 @@ void throw_invalid_argument(zval *object,
 #define PHP_DRIVER_INI_ENTRY_LOG_LEVEL \
   PHP_INI_ENTRY(PHP_DRIVER_NAME ".log_level", PHP_DRIVER_DEFAULT_LOG_LEVEL, PHP_INI_ALL, OnUpdateLogLevel)
 
+#define PHP_DRIVER_INI_ENTRY_PREPARED_CACHE_SIZE \
+  PHP_INI_ENTRY(PHP_DRIVER_NAME ".prepared_cache_size", PHP_DRIVER_DEFAULT_PREPARED_CACHE_SIZE, PHP_INI_SYSTEM, OnUpdatePreparedCacheSize)
+
 PHP_INI_MH(OnUpdateLogLevel);
 PHP_INI_MH(OnUpdateLog);
+PHP_INI_MH(OnUpdatePreparedCacheSize);
 
 #endif /* PHP_DRIVER_H */
@@ -9,6 +9,12 @@ ZEND_BEGIN_MODULE_GLOBALS(php_driver)
   pid_t         uuid_gen_pid;
   unsigned int  persistent_clusters;
   unsigned int  persistent_sessions;
+  /* Futures watched by EventLoop, keyed by object handle */
+  php5to7_zval  watched_futures;
+  /* Fibers suspended by await(), keyed by object handle */
+  HashTable    *awaiting_fibers;
+  /* Futures released before they completed, along with their statement */
+  HashTable    *released_futures;
   
   /* Type definitions for different PHP versions */
 #if PHP_VERSION_ID >= 80000
@@ -67,6 +67,8 @@
   #define PHP_DRIVER_GET_STATEMENT(obj) php_driver_statement_object_fetch(Z_OBJ_P(obj))
   #define PHP_DRIVER_GET_EXECUTION_OPTIONS(obj) php_driver_execution_options_object_fetch(Z_OBJ_P(obj))
   #define PHP_DRIVER_GET_ROWS(obj) php_driver_rows_object_fetch(Z_OBJ_P(obj))
+  #define PHP_DRIVER_GET_ROW(obj) php_driver_row_object_fetch(Z_OBJ_P(obj))
+  #define PHP_DRIVER_GET_ROW_STREAM(obj) php_driver_row_stream_object_fetch(Z_OBJ_P(obj))
   #define PHP_DRIVER_GET_FUTURE_ROWS(obj) php_driver_future_rows_object_fetch(Z_OBJ_P(obj))
   #define PHP_DRIVER_GET_CLUSTER_BUILDER(obj) php_driver_cluster_builder_object_fetch(Z_OBJ_P(obj))
   #define PHP_DRIVER_GET_FUTURE_PREPARED_STATEMENT(obj) php_driver_future_prepared_statement_object_fetch(Z_OBJ_P(obj))
@@ -106,6 +108,8 @@
   #define PHP_DRIVER_GET_STATEMENT(obj) php_driver_statement_object_fetch(Z_OBJ_P(obj))
   #define PHP_DRIVER_GET_EXECUTION_OPTIONS(obj) php_driver_execution_options_object_fetch(Z_OBJ_P(obj))
   #define PHP_DRIVER_GET_ROWS(obj) php_driver_rows_object_fetch(Z_OBJ_P(obj))
+  #define PHP_DRIVER_GET_ROW(obj) php_driver_row_object_fetch(Z_OBJ_P(obj))
+  #define PHP_DRIVER_GET_ROW_STREAM(obj) php_driver_row_stream_object_fetch(Z_OBJ_P(obj))
   #define PHP_DRIVER_GET_FUTURE_ROWS(obj) php_driver_future_rows_object_fetch(Z_OBJ_P(obj))
   #define PHP_DRIVER_GET_CLUSTER_BUILDER(obj) php_driver_cluster_builder_object_fetch(Z_OBJ_P(obj))
   #define PHP_DRIVER_GET_FUTURE_PREPARED_STATEMENT(obj) php_driver_future_prepared_statement_object_fetch(Z_OBJ_P(obj))
@@ -144,6 +148,8 @@
   #define PHP_DRIVER_GET_STATEMENT(obj) ((php_driver_statement *)zend_object_store_get_object((obj) TSRMLS_CC))
   #define PHP_DRIVER_GET_EXECUTION_OPTIONS(obj) ((php_driver_execution_options *)zend_object_store_get_object((obj) TSRMLS_CC))
   #define PHP_DRIVER_GET_ROWS(obj) ((php_driver_rows *)zend_object_store_get_object((obj) TSRMLS_CC))
+  #define PHP_DRIVER_GET_ROW(obj) ((php_driver_row *)zend_object_store_get_object((obj) TSRMLS_CC))
+  #define PHP_DRIVER_GET_ROW_STREAM(obj) ((php_driver_row_stream *)zend_object_store_get_object((obj) TSRMLS_CC))
   #define PHP_DRIVER_GET_FUTURE_ROWS(obj) ((php_driver_future_rows *)zend_object_store_get_object((obj) TSRMLS_CC))
   #define PHP_DRIVER_GET_CLUSTER_BUILDER(obj) ((php_driver_cluster_builder *)zend_object_store_get_object((obj) TSRMLS_CC))
   #define PHP_DRIVER_GET_FUTURE_PREPARED_STATEMENT(obj) ((php_driver_future_prepared_statement *)zend_object_store_get_object((obj) TSRMLS_CC))
@@ -193,10 +199,16 @@ PHP_DRIVER_BEGIN_OBJECT_TYPE(numeric)
     } floating;
     struct {
       mpz_t value;
+      /* Two's complement encoding of value, computed when first bound */
+      cass_byte_t *encoded;
+      size_t encoded_size;
     } varint;
     struct {
       mpz_t value;
       long scale;
+      /* Two's complement encoding of value, computed when first bound */
+      cass_byte_t *encoded;
+      size_t encoded_size;
     } decimal;
   } data;
 PHP_DRIVER_END_OBJECT_TYPE(numeric)
@@ -216,6 +228,11 @@ PHP_DRIVER_END_OBJECT_TYPE(time)
 PHP_DRIVER_BEGIN_OBJECT_TYPE(blob)
   cass_byte_t *data;
   size_t size;
+#if PHP_MAJOR_VERSION >= 7
+  /* When set, data points into this string, which is shared with the strings
+   * given to the constructor and returned by toBinaryString() */
+  zend_string *bytes;
+#endif
 PHP_DRIVER_END_OBJECT_TYPE(blob)
 
 PHP_DRIVER_BEGIN_OBJECT_TYPE(uuid)
@@ -237,6 +254,9 @@ PHP_DRIVER_BEGIN_OBJECT_TYPE(collection)
   HashTable values;
   unsigned hashv;
   int dirty;
+  /* Last encoding of the collection, reused until it's modified when its
+   * elements are immutable */
+  CassCollection *encoded;
 PHP_DRIVER_END_OBJECT_TYPE(collection)
 
 typedef struct php_driver_map_entry_ php_driver_map_entry;
@@ -246,6 +266,9 @@ PHP_DRIVER_BEGIN_OBJECT_TYPE(map)
   php_driver_map_entry *entries;
   unsigned hashv;
   int dirty;
+  /* Last encoding of the map, reused until it's modified when its
+   * elements are immutable */
+  CassCollection *encoded;
   php_driver_map_entry *iter_curr;
   php_driver_map_entry *iter_temp;
 PHP_DRIVER_END_OBJECT_TYPE(map)
@@ -257,6 +280,9 @@ PHP_DRIVER_BEGIN_OBJECT_TYPE(set)
   php_driver_set_entry *entries;
   unsigned hashv;
   int dirty;
+  /* Last encoding of the set, reused until it's modified when its
+   * elements are immutable */
+  CassCollection *encoded;
   php_driver_set_entry *iter_curr;
   php_driver_set_entry *iter_temp;
   int iter_index;
@@ -284,17 +310,31 @@ PHP_DRIVER_BEGIN_OBJECT_TYPE(cluster)
   long default_consistency;
   int default_page_size;
   php5to7_zval default_timeout;
+  cass_bool_t default_native_types;
+  int auto_prepare;
   cass_bool_t persist;
   char *hash_key;
   int hash_key_len;
 PHP_DRIVER_END_OBJECT_TYPE(cluster)
 
+typedef void (*php_driver_free_function)(void *data);
+
+typedef struct {
+  size_t                  count;
+  php_driver_free_function destruct;
+  void                   *data;
+} php_driver_ref;
+
 typedef enum {
   PHP_DRIVER_SIMPLE_STATEMENT,
   PHP_DRIVER_PREPARED_STATEMENT,
-  PHP_DRIVER_BATCH_STATEMENT
+  PHP_DRIVER_BATCH_STATEMENT,
+  PHP_DRIVER_BOUND_STATEMENT
 } php_driver_statement_type;
 
+typedef int (*php_driver_binder)(CassStatement *statement, size_t index,
+                                 const CassDataType *type, zval *value TSRMLS_DC);
+
 PHP_DRIVER_BEGIN_OBJECT_TYPE(statement)
   php_driver_statement_type type;
   union {
@@ -303,11 +343,27 @@ PHP_DRIVER_BEGIN_OBJECT_TYPE(statement)
     } simple;
     struct {
       const CassPrepared *prepared;
+      /* One binder per parameter, chosen from the parameter's type */
+      php_driver_binder *binders;
+      size_t binder_count;
+#if PHP_MAJOR_VERSION >= 7
+      /* Positions of the parameters by lowercased name */
+      HashTable *parameter_indices;
+#endif
+      /* Keyspace switched to by executions of a USE query */
+      char *keyspace;
     } prepared;
     struct {
       CassBatchType type;
       HashTable statements;
     } batch;
+    struct {
+      php5to7_zval prepared;
+      /* Shared with the results of its executions, rebound when it is */
+      php_driver_ref *statement;
+      /* Arguments by position or name, in the order they were last set */
+      HashTable arguments;
+    } bound;
   } data;
 PHP_DRIVER_END_OBJECT_TYPE(statement)
 
@@ -316,16 +372,41 @@ typedef struct {
   php5to7_zval arguments;
 } php_driver_batch_statement_entry;
 
+typedef enum {
+  PHP_DRIVER_FETCH_ASSOC = 0,
+  PHP_DRIVER_FETCH_NUM,
+  PHP_DRIVER_FETCH_COLUMN,
+  PHP_DRIVER_FETCH_KEY_PAIR,
+  PHP_DRIVER_FETCH_GROUP
+} php_driver_fetch_style;
+
+typedef struct {
+  int lazy;
+  int row_objects;
+  int native_types;
+  int fetch_style;
+  long fetch_column;
+  int columnar;
+  php5to7_zval columns;
+} php_driver_result_options;
+
 PHP_DRIVER_BEGIN_OBJECT_TYPE(execution_options)
   long consistency;
   long serial_consistency;
   int page_size;
   char *paging_state_token;
   size_t paging_state_token_size;
+  char *profile;
+  size_t profile_size;
   php5to7_zval timeout;
+  php5to7_zval deadline;
   php5to7_zval arguments;
   php5to7_zval retry_policy;
   cass_int64_t timestamp;
+  /* Maximum number of executions in flight for Session::executeMany() */
+  int concurrency;
+  php5to7_zval callback;
+  php_driver_result_options result;
 PHP_DRIVER_END_OBJECT_TYPE(execution_options)
 
 typedef enum {
@@ -334,14 +415,6 @@ typedef enum {
   LOAD_BALANCING_DC_AWARE_ROUND_ROBIN
 } php_driver_load_balancing;
 
-typedef void (*php_driver_free_function)(void *data);
-
-typedef struct {
-  size_t                  count;
-  php_driver_free_function destruct;
-  void                   *data;
-} php_driver_ref;
-
 PHP_DRIVER_BEGIN_OBJECT_TYPE(rows)
   php_driver_ref *statement;
   php_driver_ref *session;
@@ -350,14 +423,39 @@ PHP_DRIVER_BEGIN_OBJECT_TYPE(rows)
   php_driver_ref *result;
   php_driver_ref *next_result;
   php5to7_zval future_next_page;
+  php_driver_ref *cursor;
+  size_t position;
+  uint64_t deadline;
+  php_driver_result_options options;
+  php5to7_zval columns;
 PHP_DRIVER_END_OBJECT_TYPE(rows)
 
+PHP_DRIVER_BEGIN_OBJECT_TYPE(row)
+  php_driver_ref *cursor;
+  size_t index;
+  php5to7_zval values;
+PHP_DRIVER_END_OBJECT_TYPE(row)
+
+PHP_DRIVER_BEGIN_OBJECT_TYPE(row_stream)
+  php5to7_zval rows;
+  php5to7_zval timeout;
+  size_t position;
+  php5to7_long key;
+  int prefetch;
+  int advanced;
+PHP_DRIVER_END_OBJECT_TYPE(row_stream)
+
 PHP_DRIVER_BEGIN_OBJECT_TYPE(future_rows)
   php_driver_ref *statement;
   php_driver_ref *session;
   php5to7_zval rows;
   php_driver_ref *result;
   CassFuture *future;
+  php_driver_result_options options;
+  uint64_t deadline;
+  /* Follows the keyspace of a USE query once it succeeds */
+  php_driver_ref *prepared_cache;
+  char *keyspace;
 PHP_DRIVER_END_OBJECT_TYPE(future_rows)
 
 PHP_DRIVER_BEGIN_OBJECT_TYPE(cluster_builder)
@@ -376,6 +474,8 @@ PHP_DRIVER_BEGIN_OBJECT_TYPE(cluster_builder)
   long default_consistency;
   int default_page_size;
   php5to7_zval default_timeout;
+  cass_bool_t default_native_types;
+  int auto_prepare;
   cass_bool_t persist;
   int protocol_version;
   int io_threads;
@@ -388,6 +488,7 @@ PHP_DRIVER_BEGIN_OBJECT_TYPE(cluster_builder)
   unsigned int tcp_keepalive_delay;
   php5to7_zval retry_policy;
   php5to7_zval timestamp_gen;
+  php5to7_zval execution_profiles;
   cass_bool_t enable_schema;
   char *blacklist_hosts;
   char *whitelist_hosts;
@@ -401,6 +502,9 @@ PHP_DRIVER_END_OBJECT_TYPE(cluster_builder)
 PHP_DRIVER_BEGIN_OBJECT_TYPE(future_prepared_statement)
   CassFuture *future;
   php5to7_zval prepared_statement;
+  php_driver_ref *prepared_cache;
+  zend_string *prepared_key;
+  char *keyspace;
 PHP_DRIVER_END_OBJECT_TYPE(future_prepared_statement)
 
 PHP_DRIVER_BEGIN_OBJECT_TYPE(future_value)
@@ -420,18 +524,24 @@ PHP_DRIVER_BEGIN_OBJECT_TYPE(future_session)
   int hash_key_len;
   char *exception_message;
   CassError exception_code;
+  php_driver_ref *prepared_cache;
+  int auto_prepare;
 PHP_DRIVER_END_OBJECT_TYPE(future_session)
 
 typedef struct {
   CassFuture *future;
   php_driver_ref *session;
+  php_driver_ref *prepared_cache;
 } php_driver_psession;
 
 PHP_DRIVER_BEGIN_OBJECT_TYPE(session)
   php_driver_ref *session;
+  php_driver_ref *prepared_cache;
   long default_consistency;
   int default_page_size;
   php5to7_zval default_timeout;
+  cass_bool_t default_native_types;
+  int auto_prepare;
   cass_bool_t persist;
 PHP_DRIVER_END_OBJECT_TYPE(session)
 
@@ -656,6 +766,9 @@ extern PHP_DRIVER_API zend_class_entry *php_driver_future_rows_ce;
 extern PHP_DRIVER_API zend_class_entry *php_driver_future_session_ce;
 extern PHP_DRIVER_API zend_class_entry *php_driver_future_value_ce;
 extern PHP_DRIVER_API zend_class_entry *php_driver_future_close_ce;
+extern PHP_DRIVER_API zend_class_entry *php_driver_futures_ce;
+extern PHP_DRIVER_API zend_class_entry *php_driver_event_loop_ce;
+extern PHP_DRIVER_API zend_class_entry *php_driver_scheduler_ce;
 extern PHP_DRIVER_API zend_class_entry *php_driver_session_ce;
 extern PHP_DRIVER_API zend_class_entry *php_driver_default_session_ce;
 extern PHP_DRIVER_API zend_class_entry *php_driver_exception_ce;
@@ -688,9 +801,12 @@ extern PHP_DRIVER_API zend_class_entry *php_driver_range_exception_ce;
 extern PHP_DRIVER_API zend_class_entry *php_driver_statement_ce;
 extern PHP_DRIVER_API zend_class_entry *php_driver_simple_statement_ce;
 extern PHP_DRIVER_API zend_class_entry *php_driver_prepared_statement_ce;
+extern PHP_DRIVER_API zend_class_entry *php_driver_bound_statement_ce;
 extern PHP_DRIVER_API zend_class_entry *php_driver_batch_statement_ce;
 extern PHP_DRIVER_API zend_class_entry *php_driver_execution_options_ce;
 extern PHP_DRIVER_API zend_class_entry *php_driver_rows_ce;
+extern PHP_DRIVER_API zend_class_entry *php_driver_row_ce;
+extern PHP_DRIVER_API zend_class_entry *php_driver_row_stream_ce;
 
 void php_driver_define_Core(TSRMLS_D);
 void php_driver_define_Cluster(TSRMLS_D);
@@ -702,6 +818,9 @@ void php_driver_define_FutureRows(TSRMLS_D);
 void php_driver_define_FutureSession(TSRMLS_D);
 void php_driver_define_FutureValue(TSRMLS_D);
 void php_driver_define_FutureClose(TSRMLS_D);
+void php_driver_define_Futures(TSRMLS_D);
+void php_driver_define_EventLoop(TSRMLS_D);
+void php_driver_define_Scheduler(TSRMLS_D);
 void php_driver_define_Session(TSRMLS_D);
 void php_driver_define_DefaultSession(TSRMLS_D);
 void php_driver_define_SSLOptions(TSRMLS_D);
@@ -709,9 +828,12 @@ void php_driver_define_SSLOptionsBuilder(TSRMLS_D);
 void php_driver_define_Statement(TSRMLS_D);
 void php_driver_define_SimpleStatement(TSRMLS_D);
 void php_driver_define_PreparedStatement(TSRMLS_D);
+void php_driver_define_BoundStatement(TSRMLS_D);
 void php_driver_define_BatchStatement(TSRMLS_D);
 void php_driver_define_ExecutionOptions(TSRMLS_D);
 void php_driver_define_Rows(TSRMLS_D);
+void php_driver_define_Row(TSRMLS_D);
+void php_driver_define_RowStream(TSRMLS_D);
 
 extern PHP_DRIVER_API zend_class_entry *php_driver_schema_ce;
 extern PHP_DRIVER_API zend_class_entry *php_driver_default_schema_ce;
@@ -79,10 +79,12 @@ PHP_METHOD(BatchStatement, add)
   if (Z_TYPE_P(statement) != IS_STRING &&
       (Z_TYPE_P(statement) != IS_OBJECT ||
        (!instanceof_function(Z_OBJCE_P(statement), php_driver_simple_statement_ce TSRMLS_CC) &&
-        !instanceof_function(Z_OBJCE_P(statement), php_driver_prepared_statement_ce TSRMLS_CC)))) {
+        !instanceof_function(Z_OBJCE_P(statement), php_driver_prepared_statement_ce TSRMLS_CC) &&
+        !instanceof_function(Z_OBJCE_P(statement), php_driver_bound_statement_ce TSRMLS_CC)))) {
     INVALID_ARGUMENT(statement, "a string, an instance of "
-                     PHP_DRIVER_NAMESPACE "\\SimpleStatement or an instance of "
-                     PHP_DRIVER_NAMESPACE "\\PreparedStatement");
+                     PHP_DRIVER_NAMESPACE "\\SimpleStatement, an instance of "
+                     PHP_DRIVER_NAMESPACE "\\PreparedStatement or an instance of "
+                     PHP_DRIVER_NAMESPACE "\\BoundStatement");
   }
 
   self = PHP_DRIVER_GET_STATEMENT(getThis());
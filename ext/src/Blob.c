@@ -19,18 +19,70 @@
 #include "util/bytes.h"
 #include "util/types.h"
 
+#include "Blob.h"
+
 zend_class_entry *php_driver_blob_ce = NULL;
 
+static void
+php_driver_blob_release(php_driver_blob *blob)
+{
+#if PHP_MAJOR_VERSION >= 7
+  if (blob->bytes) {
+    zend_string_release(blob->bytes);
+    blob->bytes = NULL;
+    blob->data  = NULL;
+  }
+#endif
+  if (blob->data) {
+    efree(blob->data);
+    blob->data = NULL;
+  }
+  blob->size = 0;
+}
+
+void
+php_driver_blob_set(php_driver_blob *blob, const cass_byte_t *data, size_t size)
+{
+  php_driver_blob_release(blob);
+#if PHP_MAJOR_VERSION >= 7
+  blob->bytes = zend_string_init((const char *) data, size, 0);
+  blob->data  = (cass_byte_t *) ZSTR_VAL(blob->bytes);
+#else
+  blob->data = emalloc(size * sizeof(cass_byte_t));
+  memcpy(blob->data, data, size);
+#endif
+  blob->size = size;
+}
+
+#if PHP_MAJOR_VERSION >= 7
+void
+php_driver_blob_set_string(php_driver_blob *blob, zend_string *bytes)
+{
+  php_driver_blob_release(blob);
+  blob->bytes = zend_string_copy(bytes);
+  blob->data  = (cass_byte_t *) ZSTR_VAL(bytes);
+  blob->size  = ZSTR_LEN(bytes);
+}
+#endif
+
 void
 php_driver_blob_init(INTERNAL_FUNCTION_PARAMETERS)
 {
   php_driver_blob *self;
+#if PHP_MAJOR_VERSION >= 7
+  zend_string *string;
+
+  if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "S", &string) == FAILURE) {
+    return;
+  }
+#else
   char *string;
   php5to7_size string_len;
 
   if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "s", &string, &string_len) == FAILURE) {
     return;
   }
+#endif
 
   if (getThis() && instanceof_function(Z_OBJCE_P(getThis()), php_driver_blob_ce TSRMLS_CC)) {
     self = PHP_DRIVER_GET_BLOB(getThis());
@@ -39,9 +91,11 @@ php_driver_blob_init(INTERNAL_FUNCTION_PARAMETERS)
     self = PHP_DRIVER_GET_BLOB(return_value);
   }
 
-  self->data = emalloc(string_len * sizeof(cass_byte_t));
-  self->size = string_len;
-  memcpy(self->data, string, string_len);
+#if PHP_MAJOR_VERSION >= 7
+  php_driver_blob_set_string(self, string);
+#else
+  php_driver_blob_set(self, (const cass_byte_t *) string, string_len);
+#endif
 }
 
 /* {{{ Blob::__construct(string) */
@@ -93,6 +147,11 @@ PHP_METHOD(Blob, toBinaryString)
 {
   php_driver_blob *blob = PHP_DRIVER_GET_BLOB(getThis());
 
+#if PHP_MAJOR_VERSION >= 7
+  if (blob->bytes) {
+    RETURN_STR_COPY(blob->bytes);
+  }
+#endif
   PHP5TO7_RETVAL_STRINGL((const char *)blob->data, blob->size);
 }
 /* }}} */
@@ -213,9 +272,7 @@ php_driver_blob_free(php5to7_zend_object_free *object TSRMLS_DC)
 {
   php_driver_blob *self = PHP5TO7_ZEND_OBJECT_GET(blob, object);
 
-  if (self->data) {
-    efree(self->data);
-  }
+  php_driver_blob_release(self);
 
 #if PHP_VERSION_ID >= 80000
   zend_object_std_dtor(&self->std);
@@ -18,5 +18,9 @@
 #define PHP_DRIVER_BLOB_H
 
 void php_driver_blob_init(INTERNAL_FUNCTION_PARAMETERS);
+void php_driver_blob_set(php_driver_blob *blob, const cass_byte_t *data, size_t size);
+#if PHP_MAJOR_VERSION >= 7
+void php_driver_blob_set_string(php_driver_blob *blob, zend_string *bytes);
+#endif
 
 #endif /* PHP_DRIVER_BLOB_H */
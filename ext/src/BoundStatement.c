@@ -0,0 +1,304 @@
+/**
+ * Copyright 2017 DataStax, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "php_driver.h"
+#include "php_driver_types.h"
+#include "util/bind.h"
+#include "util/future.h"
+#include "util/ref.h"
+#include "BoundStatement.h"
+
+zend_class_entry *php_driver_bound_statement_ce = NULL;
+
+#define PREPARED(self) \
+  PHP_DRIVER_GET_STATEMENT(PHP5TO7_ZVAL_MAYBE_P((self)->data.bound.prepared))
+
+static void
+free_statement(void *statement)
+{
+  cass_statement_free((CassStatement *) statement);
+}
+
+CassStatement *
+php_driver_bound_statement_bind(php_driver_statement *self,
+                                 HashTable *arguments TSRMLS_DC)
+{
+  php_driver_statement *prepared = PREPARED(self);
+  CassStatement *statement = cass_prepared_bind(prepared->data.prepared.prepared);
+
+  if (php_driver_bind_arguments(statement, prepared,
+                                &self->data.bound.arguments TSRMLS_CC) == FAILURE ||
+      (arguments &&
+       php_driver_bind_arguments(statement, prepared, arguments TSRMLS_CC) == FAILURE)) {
+    cass_statement_free(statement);
+    return NULL;
+  }
+
+  return statement;
+}
+
+/* Rebinds the statement when it's still used by the result of an execution
+ * or by a request that hasn't completed, so that it can be modified */
+static int
+separate(php_driver_statement *self TSRMLS_DC)
+{
+  CassStatement *statement;
+
+  php_driver_future_collect(TSRMLS_C);
+
+  if (self->data.bound.statement && self->data.bound.statement->count == 1)
+    return SUCCESS;
+
+  statement = php_driver_bound_statement_bind(self, NULL TSRMLS_CC);
+  if (!statement)
+    return FAILURE;
+
+  if (self->data.bound.statement)
+    php_driver_del_ref(&self->data.bound.statement);
+  self->data.bound.statement = php_driver_new_ref(statement, free_statement);
+
+  return SUCCESS;
+}
+
+php_driver_ref *
+php_driver_bound_statement_acquire(php_driver_statement *self,
+                                    HashTable *arguments TSRMLS_DC)
+{
+  if (arguments && zend_hash_num_elements(arguments) > 0) {
+    CassStatement *statement = php_driver_bound_statement_bind(self, arguments TSRMLS_CC);
+
+    return statement ? php_driver_new_ref(statement, free_statement) : NULL;
+  }
+
+  if (separate(self TSRMLS_CC) == FAILURE)
+    return NULL;
+
+  return php_driver_add_ref(self->data.bound.statement);
+}
+
+/* Binds a single argument and remembers it, names of parameters are stored
+ * as their position so that setting a slot twice keeps only the last value */
+static int
+set_argument(php_driver_statement *self, php5to7_ulong index,
+             const char *name, size_t name_length, zval *value TSRMLS_DC)
+{
+  php_driver_statement *prepared = PREPARED(self);
+
+  if (name) {
+    php5to7_long position = php_driver_bind_plan_index(prepared, name, name_length);
+
+    if (position >= 0) {
+      index = (php5to7_ulong) position;
+      name  = NULL;
+    }
+  }
+
+  if (separate(self TSRMLS_CC) == FAILURE ||
+      php_driver_bind_argument((CassStatement *) self->data.bound.statement->data,
+                               prepared, index, name, name_length,
+                               value TSRMLS_CC) == FAILURE)
+    return FAILURE;
+
+  Z_TRY_ADDREF_P(value);
+  if (name) {
+    PHP5TO7_ZEND_HASH_DEL(&self->data.bound.arguments, name, name_length + 1);
+    PHP5TO7_ZEND_HASH_UPDATE(&self->data.bound.arguments, name, name_length + 1,
+                             value, sizeof(zval *));
+  } else {
+    zend_hash_index_del(&self->data.bound.arguments, index);
+    PHP5TO7_ZEND_HASH_INDEX_UPDATE(&self->data.bound.arguments, index,
+                                   value, sizeof(zval *));
+  }
+
+  return SUCCESS;
+}
+
+int
+php_driver_bound_statement_init(zval *return_value, zval *prepared,
+                                 HashTable *arguments TSRMLS_DC)
+{
+  php_driver_statement *self;
+  php5to7_zval *current;
+  php5to7_ulong num_key;
+  int rc = SUCCESS;
+
+  object_init_ex(return_value, php_driver_bound_statement_ce);
+  self = PHP_DRIVER_GET_STATEMENT(return_value);
+
+  PHP5TO7_ZVAL_COPY(PHP5TO7_ZVAL_MAYBE_P(self->data.bound.prepared), prepared);
+
+  if (separate(self TSRMLS_CC) == FAILURE)
+    return FAILURE;
+
+  if (!arguments)
+    return SUCCESS;
+
+#if PHP_MAJOR_VERSION >= 7
+  {
+    zend_string *key;
+    ZEND_HASH_FOREACH_KEY_VAL(arguments, num_key, key, current) {
+      rc = set_argument(self, num_key,
+                        key ? ZSTR_VAL(key) : NULL, key ? ZSTR_LEN(key) : 0,
+                        PHP5TO7_ZVAL_MAYBE_DEREF(current) TSRMLS_CC);
+      if (rc == FAILURE) break;
+    } ZEND_HASH_FOREACH_END();
+  }
+#else
+  {
+    char *str_key;
+    uint str_len;
+    PHP5TO7_ZEND_HASH_FOREACH_KEY_VAL(arguments, num_key, str_key, str_len, current) {
+      rc = set_argument(self, num_key,
+                        str_key, str_key ? str_len - 1 : 0,
+                        PHP5TO7_ZVAL_MAYBE_DEREF(current) TSRMLS_CC);
+      if (rc == FAILURE) break;
+    } PHP5TO7_ZEND_HASH_FOREACH_END(arguments);
+  }
+#endif
+
+  return rc;
+}
+
+PHP_METHOD(BoundStatement, __construct)
+{
+}
+
+PHP_METHOD(BoundStatement, set)
+{
+  zval *key;
+  zval *value;
+  php_driver_statement *self = NULL;
+  int rc;
+
+  if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "zz", &key, &value) == FAILURE) {
+    return;
+  }
+
+  self = PHP_DRIVER_GET_STATEMENT(getThis());
+
+  if (Z_TYPE_P(key) == IS_LONG && Z_LVAL_P(key) >= 0) {
+    rc = set_argument(self, (php5to7_ulong) Z_LVAL_P(key), NULL, 0, value TSRMLS_CC);
+  } else if (Z_TYPE_P(key) == IS_STRING) {
+    rc = set_argument(self, 0, Z_STRVAL_P(key), Z_STRLEN_P(key), value TSRMLS_CC);
+  } else {
+    INVALID_ARGUMENT(key, "a positive integer or a string");
+  }
+
+  if (rc == FAILURE)
+    return;
+
+  RETURN_ZVAL(getThis(), 1, 0);
+}
+
+#if PHP_VERSION_ID >= 80100
+/* Constructors cannot declare a return type; use untyped arginfo */
+ZEND_BEGIN_ARG_INFO_EX(arginfo_none, 0, 0, 0)
+ZEND_END_ARG_INFO()
+#else
+ZEND_BEGIN_ARG_INFO_EX(arginfo_none, 0, ZEND_RETURN_VALUE, 0)
+ZEND_END_ARG_INFO()
+#endif
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_set, 0, ZEND_RETURN_VALUE, 2)
+  ZEND_ARG_INFO(0, key)
+  ZEND_ARG_INFO(0, value)
+ZEND_END_ARG_INFO()
+
+static zend_function_entry php_driver_bound_statement_methods[] = {
+  PHP_ME(BoundStatement, __construct, arginfo_none, ZEND_ACC_PRIVATE | ZEND_ACC_CTOR)
+  PHP_ME(BoundStatement, set, arginfo_set, ZEND_ACC_PUBLIC)
+  PHP_FE_END
+};
+
+static zend_object_handlers php_driver_bound_statement_handlers;
+
+#if PHP_VERSION_ID >= 80000
+static HashTable *
+php_driver_bound_statement_properties(zend_object *object)
+{
+  return zend_std_get_properties(object);
+}
+#else
+static HashTable *
+php_driver_bound_statement_properties(zval *object TSRMLS_DC)
+{
+  return zend_std_get_properties(object TSRMLS_CC);
+}
+#endif
+
+#if PHP_VERSION_ID < 80000
+static int
+php_driver_bound_statement_compare(zval *obj1, zval *obj2 TSRMLS_DC)
+{
+  if (Z_OBJCE_P(obj1) != Z_OBJCE_P(obj2))
+    return 1; /* different classes */
+
+  return Z_OBJ_HANDLE_P(obj1) != Z_OBJ_HANDLE_P(obj2);
+}
+#endif
+
+static void
+php_driver_bound_statement_free(php5to7_zend_object_free *object TSRMLS_DC)
+{
+  php_driver_statement *self = PHP5TO7_ZEND_OBJECT_GET(statement, object);
+
+  if (self->data.bound.statement)
+    php_driver_del_ref(&self->data.bound.statement);
+  zend_hash_destroy(&self->data.bound.arguments);
+  PHP5TO7_ZVAL_MAYBE_DESTROY(self->data.bound.prepared);
+
+#if PHP_VERSION_ID >= 80000
+  zend_object_std_dtor(&self->std);
+#else
+  zend_object_std_dtor(&self->zval TSRMLS_CC);
+#endif
+  PHP5TO7_MAYBE_EFREE(self);
+}
+
+static php5to7_zend_object
+php_driver_bound_statement_new(zend_class_entry *ce TSRMLS_DC)
+{
+  php_driver_statement *self =
+      PHP5TO7_ZEND_OBJECT_ECALLOC(statement, ce);
+
+  self->type = PHP_DRIVER_BOUND_STATEMENT;
+  self->data.bound.statement = NULL;
+  PHP5TO7_ZVAL_UNDEF(self->data.bound.prepared);
+  zend_hash_init(&self->data.bound.arguments, 0, NULL, ZVAL_PTR_DTOR, 0);
+
+  PHP5TO7_ZEND_OBJECT_INIT_EX(statement, bound_statement, self, ce);
+}
+
+void php_driver_define_BoundStatement(TSRMLS_D)
+{
+  zend_class_entry ce;
+
+  INIT_CLASS_ENTRY(ce, PHP_DRIVER_NAMESPACE "\\BoundStatement", php_driver_bound_statement_methods);
+  php_driver_bound_statement_ce = zend_register_internal_class(&ce TSRMLS_CC);
+  zend_class_implements(php_driver_bound_statement_ce TSRMLS_CC, 1, php_driver_statement_ce);
+  php_driver_bound_statement_ce->ce_flags     |= PHP5TO7_ZEND_ACC_FINAL;
+  php_driver_bound_statement_ce->create_object = php_driver_bound_statement_new;
+
+  memcpy(&php_driver_bound_statement_handlers, zend_get_std_object_handlers(), sizeof(zend_object_handlers));
+  php_driver_bound_statement_handlers.get_properties = php_driver_bound_statement_properties;
+#if PHP_VERSION_ID < 80000
+  php_driver_bound_statement_handlers.compare_objects = php_driver_bound_statement_compare;
+#endif
+#if PHP_MAJOR_VERSION >= 7
+  php_driver_bound_statement_handlers.free_obj = php_driver_bound_statement_free;
+#endif
+  php_driver_bound_statement_handlers.clone_obj = NULL;
+}
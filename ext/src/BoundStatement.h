@@ -0,0 +1,37 @@
+/**
+ * Copyright 2017 DataStax, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PHP_DRIVER_BOUND_STATEMENT_H
+#define PHP_DRIVER_BOUND_STATEMENT_H
+
+int
+php_driver_bound_statement_init(zval *return_value, zval *prepared,
+                                 HashTable *arguments TSRMLS_DC);
+
+/* Binds the prepared statement to the arguments set so far followed by the
+ * given arguments into a new statement */
+CassStatement *
+php_driver_bound_statement_bind(php_driver_statement *self,
+                                 HashTable *arguments TSRMLS_DC);
+
+/* Returns a reference to the statement to execute, the bound statement's own
+ * unless extra arguments are given, only the caller and the bound statement
+ * share it */
+php_driver_ref *
+php_driver_bound_statement_acquire(php_driver_statement *self,
+                                    HashTable *arguments TSRMLS_DC);
+
+#endif /* PHP_DRIVER_BOUND_STATEMENT_H */
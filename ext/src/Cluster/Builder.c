@@ -18,6 +18,7 @@
 #include "php_driver_globals.h"
 #include "php_driver_types.h"
 #include "util/consistency.h"
+#include "src/ExecutionOptions.h"
 
 #if PHP_MAJOR_VERSION >= 7
 #include <zend_smart_str.h>
@@ -27,6 +28,92 @@
 
 zend_class_entry *php_driver_cluster_builder_ce = NULL;
 
+/* Only the options handled by the driver's execution profiles apply, the
+ * ones of the results stay with each execution */
+static CassExecProfile *
+create_execution_profile(zval *options TSRMLS_DC)
+{
+  php_driver_execution_options opts;
+  php5to7_zval *datacenter = NULL;
+  CassExecProfile *profile;
+
+  if (php_driver_execution_options_build_local_from_array(&opts, options TSRMLS_CC) == FAILURE)
+    return NULL;
+
+  if (PHP5TO7_ZEND_HASH_FIND(Z_ARRVAL_P(options), "datacenter", sizeof("datacenter"), datacenter) &&
+      Z_TYPE_P(PHP5TO7_ZVAL_MAYBE_DEREF(datacenter)) != IS_STRING) {
+    throw_invalid_argument(PHP5TO7_ZVAL_MAYBE_DEREF(datacenter), "datacenter", "a string" TSRMLS_CC);
+    return NULL;
+  }
+
+  profile = cass_execution_profile_new();
+
+  if (opts.consistency >= 0)
+    cass_execution_profile_set_consistency(profile, (CassConsistency) opts.consistency);
+
+  if (opts.serial_consistency >= 0)
+    cass_execution_profile_set_serial_consistency(profile, (CassConsistency) opts.serial_consistency);
+
+  if (!PHP5TO7_ZVAL_IS_UNDEF(opts.timeout)) {
+    zval *timeout = PHP5TO7_ZVAL_MAYBE_P(opts.timeout);
+
+    if (Z_TYPE_P(timeout) == IS_LONG) {
+      cass_execution_profile_set_request_timeout(profile, Z_LVAL_P(timeout) * 1000);
+    } else if (Z_TYPE_P(timeout) == IS_DOUBLE) {
+      cass_execution_profile_set_request_timeout(profile, ceil(Z_DVAL_P(timeout) * 1000));
+    }
+  }
+
+  if (!PHP5TO7_ZVAL_IS_UNDEF(opts.retry_policy)) {
+    php_driver_retry_policy *retry_policy =
+        PHP_DRIVER_GET_RETRY_POLICY(PHP5TO7_ZVAL_MAYBE_P(opts.retry_policy));
+    cass_execution_profile_set_retry_policy(profile, retry_policy->policy);
+  }
+
+  if (datacenter) {
+    cass_execution_profile_set_load_balance_dc_aware(profile,
+                                                     Z_STRVAL_P(PHP5TO7_ZVAL_MAYBE_DEREF(datacenter)),
+                                                     0, cass_false);
+  }
+
+  return profile;
+}
+
+/* Persistent clusters are only shared by builders registering the same
+ * profiles, retry policies are left out like the cluster's own */
+static void
+execution_profiles_hash_key(php_driver_cluster_builder *self, smart_str *key TSRMLS_DC)
+{
+  zend_string *name;
+  zval *options;
+
+  if (PHP5TO7_ZVAL_IS_UNDEF(self->execution_profiles))
+    return;
+
+  ZEND_HASH_FOREACH_STR_KEY_VAL(PHP5TO7_Z_ARRVAL_MAYBE_P(self->execution_profiles), name, options) {
+    php_driver_execution_options opts;
+    php5to7_zval *datacenter = NULL;
+
+    php_driver_execution_options_build_local_from_array(&opts, options TSRMLS_CC);
+    (void) PHP5TO7_ZEND_HASH_FIND(Z_ARRVAL_P(options), "datacenter", sizeof("datacenter"), datacenter);
+
+    smart_str_appendc(key, ':');
+    smart_str_append(key, name);
+    smart_str_appendc(key, '=');
+    smart_str_append_long(key, opts.consistency);
+    smart_str_appendc(key, ',');
+    smart_str_append_long(key, opts.serial_consistency);
+    smart_str_appendc(key, ',');
+    if (!PHP5TO7_ZVAL_IS_UNDEF(opts.timeout) &&
+        Z_TYPE_P(PHP5TO7_ZVAL_MAYBE_P(opts.timeout)) != IS_NULL) {
+      smart_str_append_double(key, zval_get_double(PHP5TO7_ZVAL_MAYBE_P(opts.timeout)), 6, 0);
+    }
+    smart_str_appendc(key, ',');
+    if (datacenter)
+      smart_str_append(key, Z_STR_P(PHP5TO7_ZVAL_MAYBE_DEREF(datacenter)));
+  } ZEND_HASH_FOREACH_END();
+}
+
 PHP_METHOD(ClusterBuilder, build)
 {
   CassError rc;
@@ -39,6 +126,8 @@ PHP_METHOD(ClusterBuilder, build)
   cluster->persist             = self->persist;
   cluster->default_consistency = self->default_consistency;
   cluster->default_page_size   = self->default_page_size;
+  cluster->default_native_types = self->default_native_types;
+  cluster->auto_prepare        = self->auto_prepare;
 
   PHP5TO7_ZVAL_COPY(PHP5TO7_ZVAL_MAYBE_P(cluster->default_timeout),
                     PHP5TO7_ZVAL_MAYBE_P(self->default_timeout));
@@ -61,6 +150,19 @@ PHP_METHOD(ClusterBuilder, build)
                                      SAFE_STR(self->whitelist_hosts), SAFE_STR(self->whitelist_dcs),
                                      SAFE_STR(self->blacklist_hosts), SAFE_STR(self->blacklist_dcs));
 
+    if (!PHP5TO7_ZVAL_IS_UNDEF(self->execution_profiles)) {
+      smart_str key = { 0 };
+
+      smart_str_appendl(&key, cluster->hash_key, cluster->hash_key_len);
+      execution_profiles_hash_key(self, &key TSRMLS_CC);
+      smart_str_0(&key);
+
+      efree(cluster->hash_key);
+      cluster->hash_key     = estrndup(ZSTR_VAL(key.s), ZSTR_LEN(key.s));
+      cluster->hash_key_len = ZSTR_LEN(key.s);
+      smart_str_free(&key);
+    }
+
     if (self->persist) {
       php5to7_zend_resource_le *le;
 
@@ -151,6 +253,24 @@ PHP_METHOD(ClusterBuilder, build)
     cass_cluster_set_retry_policy(cluster->cluster, retry_policy->policy);
   }
 
+  if (!PHP5TO7_ZVAL_IS_UNDEF(self->execution_profiles)) {
+    zend_string *name;
+    zval *options;
+
+    ZEND_HASH_FOREACH_STR_KEY_VAL(PHP5TO7_Z_ARRVAL_MAYBE_P(self->execution_profiles), name, options) {
+      CassExecProfile *profile = create_execution_profile(options TSRMLS_CC);
+
+      if (!profile)
+        return;
+
+      rc = cass_cluster_set_execution_profile_n(cluster->cluster,
+                                                ZSTR_VAL(name), ZSTR_LEN(name),
+                                                profile);
+      cass_execution_profile_free(profile);
+      ASSERT_SUCCESS(rc);
+    } ZEND_HASH_FOREACH_END();
+  }
+
   if (self->persist) {
     php5to7_zend_resource_le resource;
 
@@ -214,6 +334,45 @@ PHP_METHOD(ClusterBuilder, withDefaultPageSize)
   RETURN_ZVAL(getThis(), 1, 0);
 }
 
+PHP_METHOD(ClusterBuilder, withNativeTypes)
+{
+  zend_bool enabled = 1;
+  php_driver_cluster_builder *self;
+
+  if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "|b", &enabled) == FAILURE) {
+    return;
+  }
+
+  self = PHP_DRIVER_GET_CLUSTER_BUILDER(getThis());
+
+  self->default_native_types = enabled;
+
+  RETURN_ZVAL(getThis(), 1, 0);
+}
+
+PHP_METHOD(ClusterBuilder, withAutoPrepare)
+{
+  zval *threshold = NULL;
+  php_driver_cluster_builder *self;
+
+  if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z", &threshold) == FAILURE) {
+    return;
+  }
+
+  self = PHP_DRIVER_GET_CLUSTER_BUILDER(getThis());
+
+  if (Z_TYPE_P(threshold) == IS_NULL) {
+    self->auto_prepare = 0;
+  } else if (Z_TYPE_P(threshold) == IS_LONG &&
+             Z_LVAL_P(threshold) > 0 && Z_LVAL_P(threshold) <= INT_MAX) {
+    self->auto_prepare = (int) Z_LVAL_P(threshold);
+  } else {
+    INVALID_ARGUMENT(threshold, "a positive integer or null");
+  }
+
+  RETURN_ZVAL(getThis(), 1, 0);
+}
+
 PHP_METHOD(ClusterBuilder, withDefaultTimeout)
 {
   zval *timeout = NULL;
@@ -866,6 +1025,42 @@ PHP_METHOD(ClusterBuilder, withTimestampGenerator)
   RETURN_ZVAL(getThis(), 1, 0);
 }
 
+PHP_METHOD(ClusterBuilder, withExecutionProfile)
+{
+  zend_string *name;
+  zval *options = NULL;
+  zval copy;
+  CassExecProfile *profile;
+  php_driver_cluster_builder *self;
+
+  if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "Sa", &name, &options) == FAILURE) {
+    return;
+  }
+
+  if (ZSTR_LEN(name) == 0) {
+    zend_throw_exception_ex(php_driver_invalid_argument_exception_ce, 0 TSRMLS_CC,
+                            "Execution profiles must have a name");
+    return;
+  }
+
+  /* Validates the options, the profile is created again by build() */
+  profile = create_execution_profile(options TSRMLS_CC);
+  if (!profile)
+    return;
+  cass_execution_profile_free(profile);
+
+  self = PHP_DRIVER_GET_CLUSTER_BUILDER(getThis());
+
+  if (PHP5TO7_ZVAL_IS_UNDEF(self->execution_profiles)) {
+    array_init(PHP5TO7_ZVAL_MAYBE_P(self->execution_profiles));
+  }
+
+  ZVAL_COPY(&copy, options);
+  zend_hash_update(PHP5TO7_Z_ARRVAL_MAYBE_P(self->execution_profiles), name, &copy);
+
+  RETURN_ZVAL(getThis(), 1, 0);
+}
+
 PHP_METHOD(ClusterBuilder, withSchemaMetadata)
 {
   zend_bool enabled = 1;
@@ -979,6 +1174,10 @@ ZEND_BEGIN_ARG_INFO_EX(arginfo_whitelist_dcs, 0, ZEND_RETURN_VALUE, 1)
   ZEND_ARG_INFO(0, dcs)
 ZEND_END_ARG_INFO()
 
+ZEND_BEGIN_ARG_INFO_EX(arginfo_threshold, 0, ZEND_RETURN_VALUE, 1)
+  ZEND_ARG_INFO(0, threshold)
+ZEND_END_ARG_INFO()
+
 ZEND_BEGIN_ARG_INFO_EX(arginfo_enabled, 0, ZEND_RETURN_VALUE, 0)
   ZEND_ARG_INFO(0, enabled)
 ZEND_END_ARG_INFO()
@@ -1025,11 +1224,18 @@ ZEND_BEGIN_ARG_INFO_EX(arginfo_timestamp_gen, 0, ZEND_RETURN_VALUE, 1)
   PHP_DRIVER_NAMESPACE_ZEND_ARG_OBJ_INFO(0, generator, TimestampGenerator, 0)
 ZEND_END_ARG_INFO()
 
+ZEND_BEGIN_ARG_INFO_EX(arginfo_execution_profile, 0, ZEND_RETURN_VALUE, 2)
+  ZEND_ARG_INFO(0, name)
+  ZEND_ARG_ARRAY_INFO(0, options, 0)
+ZEND_END_ARG_INFO()
+
 static zend_function_entry php_driver_cluster_builder_methods[] = {
   PHP_ME(ClusterBuilder, build, arginfo_none, ZEND_ACC_PUBLIC)
   PHP_ME(ClusterBuilder, withDefaultConsistency, arginfo_consistency, ZEND_ACC_PUBLIC)
   PHP_ME(ClusterBuilder, withDefaultPageSize, arginfo_page_size, ZEND_ACC_PUBLIC)
   PHP_ME(ClusterBuilder, withDefaultTimeout, arginfo_timeout, ZEND_ACC_PUBLIC)
+  PHP_ME(ClusterBuilder, withNativeTypes, arginfo_enabled, ZEND_ACC_PUBLIC)
+  PHP_ME(ClusterBuilder, withAutoPrepare, arginfo_threshold, ZEND_ACC_PUBLIC)
   PHP_ME(ClusterBuilder, withContactPoints, arginfo_contact_points, ZEND_ACC_PUBLIC)
   PHP_ME(ClusterBuilder, withPort, arginfo_port, ZEND_ACC_PUBLIC)
   PHP_ME(ClusterBuilder, withRoundRobinLoadBalancingPolicy, arginfo_none, ZEND_ACC_PUBLIC)
@@ -1053,6 +1259,7 @@ static zend_function_entry php_driver_cluster_builder_methods[] = {
   PHP_ME(ClusterBuilder, withTCPKeepalive, arginfo_delay, ZEND_ACC_PUBLIC)
   PHP_ME(ClusterBuilder, withRetryPolicy, arginfo_retry_policy, ZEND_ACC_PUBLIC)
   PHP_ME(ClusterBuilder, withTimestampGenerator, arginfo_timestamp_gen, ZEND_ACC_PUBLIC)
+  PHP_ME(ClusterBuilder, withExecutionProfile, arginfo_execution_profile, ZEND_ACC_PUBLIC)
   PHP_ME(ClusterBuilder, withSchemaMetadata, arginfo_enabled, ZEND_ACC_PUBLIC)
   PHP_ME(ClusterBuilder, withHostnameResolution, arginfo_enabled, ZEND_ACC_PUBLIC)
   PHP_ME(ClusterBuilder, withRandomizedContactPoints, arginfo_enabled, ZEND_ACC_PUBLIC)
@@ -1097,6 +1304,8 @@ php_driver_cluster_builder_properties(zval *object TSRMLS_DC)
   php5to7_zval defaultConsistency;
   php5to7_zval defaultPageSize;
   php5to7_zval defaultTimeout;
+  php5to7_zval nativeTypes;
+  php5to7_zval autoPrepare;
   php5to7_zval usePersistentSessions;
   php5to7_zval protocolVersion;
   php5to7_zval ioThreads;
@@ -1112,6 +1321,7 @@ php_driver_cluster_builder_properties(zval *object TSRMLS_DC)
   php5to7_zval blacklistDCs;
   php5to7_zval whitelistDCs;
   php5to7_zval timestampGen;
+  php5to7_zval executionProfiles;
   php5to7_zval schemaMetadata;
   php5to7_zval hostnameResolution;
   php5to7_zval randomizedContactPoints;
@@ -1182,6 +1392,16 @@ php_driver_cluster_builder_properties(zval *object TSRMLS_DC)
     ZVAL_NULL(PHP5TO7_ZVAL_MAYBE_P(defaultTimeout));
   }
 
+  PHP5TO7_ZVAL_MAYBE_MAKE(nativeTypes);
+  ZVAL_BOOL(PHP5TO7_ZVAL_MAYBE_P(nativeTypes), self->default_native_types);
+
+  PHP5TO7_ZVAL_MAYBE_MAKE(autoPrepare);
+  if (self->auto_prepare > 0) {
+    ZVAL_LONG(PHP5TO7_ZVAL_MAYBE_P(autoPrepare), self->auto_prepare);
+  } else {
+    ZVAL_NULL(PHP5TO7_ZVAL_MAYBE_P(autoPrepare));
+  }
+
   PHP5TO7_ZVAL_MAYBE_MAKE(usePersistentSessions);
   ZVAL_BOOL(PHP5TO7_ZVAL_MAYBE_P(usePersistentSessions), self->persist);
 
@@ -1255,6 +1475,13 @@ php_driver_cluster_builder_properties(zval *object TSRMLS_DC)
     ZVAL_NULL(PHP5TO7_ZVAL_MAYBE_P(timestampGen));
   }
 
+  PHP5TO7_ZVAL_MAYBE_MAKE(executionProfiles);
+  if (!PHP5TO7_ZVAL_IS_UNDEF(self->execution_profiles)) {
+    PHP5TO7_ZVAL_COPY(PHP5TO7_ZVAL_MAYBE_P(executionProfiles), PHP5TO7_ZVAL_MAYBE_P(self->execution_profiles));
+  } else {
+    array_init(PHP5TO7_ZVAL_MAYBE_P(executionProfiles));
+  }
+
   PHP5TO7_ZVAL_MAYBE_MAKE(schemaMetadata);
   ZVAL_BOOL(PHP5TO7_ZVAL_MAYBE_P(schemaMetadata), self->enable_schema);
 
@@ -1295,6 +1522,10 @@ php_driver_cluster_builder_properties(zval *object TSRMLS_DC)
                            PHP5TO7_ZVAL_MAYBE_P(defaultPageSize), sizeof(zval));
   PHP5TO7_ZEND_HASH_UPDATE(props, "defaultTimeout", sizeof("defaultTimeout"),
                            PHP5TO7_ZVAL_MAYBE_P(defaultTimeout), sizeof(zval));
+  PHP5TO7_ZEND_HASH_UPDATE(props, "nativeTypes", sizeof("nativeTypes"),
+                           PHP5TO7_ZVAL_MAYBE_P(nativeTypes), sizeof(zval));
+  PHP5TO7_ZEND_HASH_UPDATE(props, "autoPrepare", sizeof("autoPrepare"),
+                           PHP5TO7_ZVAL_MAYBE_P(autoPrepare), sizeof(zval));
   PHP5TO7_ZEND_HASH_UPDATE(props, "usePersistentSessions", sizeof("usePersistentSessions"),
                            PHP5TO7_ZVAL_MAYBE_P(usePersistentSessions), sizeof(zval));
   PHP5TO7_ZEND_HASH_UPDATE(props, "protocolVersion", sizeof("protocolVersion"),
@@ -1317,6 +1548,8 @@ php_driver_cluster_builder_properties(zval *object TSRMLS_DC)
                            PHP5TO7_ZVAL_MAYBE_P(retryPolicy), sizeof(zval));
   PHP5TO7_ZEND_HASH_UPDATE(props, "timestampGenerator", sizeof("timestampGenerator"),
                            PHP5TO7_ZVAL_MAYBE_P(timestampGen), sizeof(zval));
+  PHP5TO7_ZEND_HASH_UPDATE(props, "executionProfiles", sizeof("executionProfiles"),
+                           PHP5TO7_ZVAL_MAYBE_P(executionProfiles), sizeof(zval));
   PHP5TO7_ZEND_HASH_UPDATE(props, "schemaMetadata", sizeof("schemaMetadata"),
                            PHP5TO7_ZVAL_MAYBE_P(schemaMetadata), sizeof(zval));
   PHP5TO7_ZEND_HASH_UPDATE(props, "blacklist_hosts", sizeof("blacklist_hosts"),
@@ -1389,6 +1622,7 @@ php_driver_cluster_builder_free(php5to7_zend_object_free *object TSRMLS_DC)
   PHP5TO7_ZVAL_MAYBE_DESTROY(self->default_timeout);
   PHP5TO7_ZVAL_MAYBE_DESTROY(self->retry_policy);
   PHP5TO7_ZVAL_MAYBE_DESTROY(self->timestamp_gen);
+  PHP5TO7_ZVAL_MAYBE_DESTROY(self->execution_profiles);
 
 #if PHP_VERSION_ID >= 80000
   zend_object_std_dtor(&self->std);
@@ -1417,6 +1651,8 @@ php_driver_cluster_builder_new(zend_class_entry *ce TSRMLS_DC)
   self->request_timeout = 12000;
   self->default_consistency = PHP_DRIVER_DEFAULT_CONSISTENCY;
   self->default_page_size = 5000;
+  self->default_native_types = 0;
+  self->auto_prepare = 0;
   self->persist = 1;
   self->protocol_version = 4;
   self->io_threads = 1;
@@ -1440,6 +1676,7 @@ php_driver_cluster_builder_new(zend_class_entry *ce TSRMLS_DC)
   PHP5TO7_ZVAL_UNDEF(self->default_timeout);
   PHP5TO7_ZVAL_UNDEF(self->retry_policy);
   PHP5TO7_ZVAL_UNDEF(self->timestamp_gen);
+  PHP5TO7_ZVAL_UNDEF(self->execution_profiles);
 
 #if PHP_VERSION_ID >= 80000
   zend_object_std_init(&self->std, ce);
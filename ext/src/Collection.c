@@ -29,6 +29,7 @@ php_driver_collection_add(php_driver_collection *collection, zval *object TSRMLS
   PHP5TO7_ZEND_HASH_NEXT_INDEX_INSERT(&collection->values, object, sizeof(zval *));
   Z_TRY_ADDREF_P(object);
   collection->dirty = 1;
+  PHP_DRIVER_CLEAR_ENCODED(collection);
 }
 
 static int
@@ -36,6 +37,7 @@ php_driver_collection_del(php_driver_collection *collection, ulong index)
 {
   if (zend_hash_index_del(&collection->values, index) == SUCCESS) {
     collection->dirty = 1;
+    PHP_DRIVER_CLEAR_ENCODED(collection);
     return 1;
   }
 
@@ -474,6 +476,7 @@ php_driver_collection_free(php5to7_zend_object_free *object TSRMLS_DC)
 
   zend_hash_destroy(&self->values);
   PHP5TO7_ZVAL_MAYBE_DESTROY(self->type);
+  PHP_DRIVER_CLEAR_ENCODED(self);
 
 #if PHP_VERSION_ID >= 80000
   zend_object_std_dtor(&self->std);
@@ -527,4 +530,7 @@ void php_driver_define_Collection(TSRMLS_D)
   php_driver_collection_handlers.hash_value = php_driver_collection_hash_value;
 #endif
   php_driver_collection_handlers.std.clone_obj = NULL;
+#if PHP_MAJOR_VERSION >= 7
+  php_driver_collection_handlers.std.free_obj = php_driver_collection_free;
+#endif
 }
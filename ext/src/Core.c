@@ -67,6 +67,12 @@ void php_driver_define_Core(TSRMLS_D)
   zend_declare_class_constant_long(php_driver_core_ce, ZEND_STRL("BATCH_UNLOGGED"), CASS_BATCH_TYPE_UNLOGGED TSRMLS_CC);
   zend_declare_class_constant_long(php_driver_core_ce, ZEND_STRL("BATCH_COUNTER"),  CASS_BATCH_TYPE_COUNTER TSRMLS_CC);
 
+  zend_declare_class_constant_long(php_driver_core_ce, ZEND_STRL("FETCH_ASSOC"),    PHP_DRIVER_FETCH_ASSOC TSRMLS_CC);
+  zend_declare_class_constant_long(php_driver_core_ce, ZEND_STRL("FETCH_NUM"),      PHP_DRIVER_FETCH_NUM TSRMLS_CC);
+  zend_declare_class_constant_long(php_driver_core_ce, ZEND_STRL("FETCH_COLUMN"),   PHP_DRIVER_FETCH_COLUMN TSRMLS_CC);
+  zend_declare_class_constant_long(php_driver_core_ce, ZEND_STRL("FETCH_KEY_PAIR"), PHP_DRIVER_FETCH_KEY_PAIR TSRMLS_CC);
+  zend_declare_class_constant_long(php_driver_core_ce, ZEND_STRL("FETCH_GROUP"),    PHP_DRIVER_FETCH_GROUP TSRMLS_CC);
+
   zend_declare_class_constant_long(php_driver_core_ce, ZEND_STRL("LOG_DISABLED"), CASS_LOG_DISABLED TSRMLS_CC);
   zend_declare_class_constant_long(php_driver_core_ce, ZEND_STRL("LOG_CRITICAL"), CASS_LOG_CRITICAL TSRMLS_CC);
   zend_declare_class_constant_long(php_driver_core_ce, ZEND_STRL("LOG_ERROR"),    CASS_LOG_ERROR TSRMLS_CC);
@@ -232,6 +232,12 @@ php_driver_decimal_init(INTERNAL_FUNCTION_PARAMETERS)
     self = PHP_DRIVER_GET_NUMERIC(return_value);
   }
 
+  /* The value changes when the constructor is called again */
+  if (self->data.decimal.encoded) {
+    free(self->data.decimal.encoded);
+    self->data.decimal.encoded = NULL;
+  }
+
   if (Z_TYPE_P(value) == IS_LONG) {
     mpz_set_si(self->data.decimal.value, Z_LVAL_P(value));
     self->data.decimal.scale = 0;
@@ -647,6 +653,7 @@ static void php_driver_decimal_free_obj(zend_object *object)
 {
   php_driver_numeric *self = php_driver_numeric_object_fetch(object);
   mpz_clear(self->data.decimal.value);
+  free(self->data.decimal.encoded);
   zend_object_std_dtor(object);
 }
 #else
@@ -656,6 +663,7 @@ php_driver_decimal_free(php5to7_zend_object_free *object TSRMLS_DC)
   php_driver_numeric *self = PHP5TO7_ZEND_OBJECT_GET(numeric, object);
 
   mpz_clear(self->data.decimal.value);
+  free(self->data.decimal.encoded);
   zend_object_std_dtor(&self->zval TSRMLS_CC);
   PHP5TO7_MAYBE_EFREE(self);
 }
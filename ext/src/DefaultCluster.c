@@ -18,6 +18,7 @@
 #include "php_driver_globals.h"
 #include "php_driver_types.h"
 #include "util/future.h"
+#include "util/prepared_cache.h"
 #include "util/ref.h"
 
 zend_class_entry *php_driver_default_cluster_ce = NULL;
@@ -28,6 +29,138 @@ free_session(void *session)
   cass_session_free((CassSession*) session);
 }
 
+static CassFuture *
+connect_session(php_driver_cluster *self, php_driver_ref *session,
+                const char *keyspace)
+{
+  if (keyspace)
+    return cass_session_connect_keyspace((CassSession *) session->data,
+                                         self->cluster,
+                                         keyspace);
+
+  return cass_session_connect((CassSession *) session->data, self->cluster);
+}
+
+/* Finds the session of a keyspace shared across requests or starts
+ * connecting a new one. Its key in the persistent list is returned in
+ * hash_key, which must be freed by the caller */
+static php_driver_psession *
+persistent_session(php_driver_cluster *self, const char *keyspace,
+                   char **hash_key, php5to7_size *hash_key_len TSRMLS_DC)
+{
+  php5to7_zend_resource_le *le;
+  php5to7_zend_resource_le resource;
+  php_driver_psession *psession;
+
+  *hash_key_len = spprintf(hash_key, 0, "%s:session:%s",
+                           self->hash_key, SAFE_STR(keyspace));
+
+  if (PHP5TO7_ZEND_HASH_FIND(&EG(persistent_list), *hash_key, *hash_key_len + 1, le) &&
+      Z_RES_P(le)->type == php_le_php_driver_session()) {
+    return (php_driver_psession *) Z_RES_P(le)->ptr;
+  }
+
+  psession = (php_driver_psession *) pecalloc(1, sizeof(php_driver_psession), 1);
+  psession->session = php_driver_new_peref(cass_session_new(), free_session, 1);
+  psession->future  = connect_session(self, psession->session, keyspace);
+  psession->prepared_cache = php_driver_prepared_cache_new(keyspace);
+
+#if PHP_MAJOR_VERSION >= 7
+  ZVAL_NEW_PERSISTENT_RES(&resource, 0, psession, php_le_php_driver_session());
+  PHP5TO7_ZEND_HASH_UPDATE(&EG(persistent_list), *hash_key, *hash_key_len + 1, &resource, sizeof(php5to7_zend_resource_le));
+  PHP_DRIVER_G(persistent_sessions)++;
+#else
+  resource.type = php_le_php_driver_session();
+  resource.ptr = psession;
+  PHP5TO7_ZEND_HASH_UPDATE(&EG(persistent_list), *hash_key, *hash_key_len + 1, resource, sizeof(php5to7_zend_resource_le));
+  PHP_DRIVER_G(persistent_sessions)++;
+#endif
+
+  return psession;
+}
+
+/* Waits for a persistent session to connect, it's removed from the
+ * persistent list if it failed so that the next request retries */
+static int
+wait_persistent_session(php_driver_psession *psession, char *hash_key,
+                        php5to7_size hash_key_len, zval *timeout TSRMLS_DC)
+{
+  int rc = SUCCESS;
+
+  if (php_driver_future_wait_timed(psession->future, timeout TSRMLS_CC) == FAILURE) {
+    rc = FAILURE;
+  } else if (php_driver_future_is_error(psession->future TSRMLS_CC) == FAILURE) {
+    (void) PHP5TO7_ZEND_HASH_DEL(&EG(persistent_list), hash_key, hash_key_len + 1);
+    rc = FAILURE;
+  }
+
+  efree(hash_key);
+
+  return rc;
+}
+
+/* Prepares the queries of a persistent session that aren't cached yet, all
+ * of them concurrently */
+static int
+preload_statements(php_driver_psession *psession, HashTable *queries,
+                   zval *timeout TSRMLS_DC)
+{
+  CassSession *session = (CassSession *) psession->session->data;
+  uint32_t count = zend_hash_num_elements(queries);
+  CassFuture **futures;
+  zend_string **keys;
+  uint32_t started = 0;
+  uint32_t i;
+  zval *query;
+  int rc = SUCCESS;
+
+  ZEND_HASH_FOREACH_VAL(queries, query) {
+    if (Z_TYPE_P(query) != IS_STRING) {
+      throw_invalid_argument(query, "query", "a string");
+      return FAILURE;
+    }
+  } ZEND_HASH_FOREACH_END();
+
+  if (!psession->prepared_cache || count == 0)
+    return SUCCESS;
+
+  futures = (CassFuture **) ecalloc(count, sizeof(CassFuture *));
+  keys    = (zend_string **) ecalloc(count, sizeof(zend_string *));
+
+  ZEND_HASH_FOREACH_VAL(queries, query) {
+    zend_string *key = php_driver_prepared_cache_key(psession->prepared_cache,
+                                                     Z_STRVAL_P(query), Z_STRLEN_P(query));
+    const CassPrepared *prepared = php_driver_prepared_cache_find(psession->prepared_cache, key);
+
+    if (prepared) {
+      cass_prepared_free(prepared);
+      zend_string_release(key);
+      continue;
+    }
+
+    keys[started]    = key;
+    futures[started] = cass_session_prepare_n(session, Z_STRVAL_P(query), Z_STRLEN_P(query));
+    started++;
+  } ZEND_HASH_FOREACH_END();
+
+  for (i = 0; i < started; i++) {
+    if (rc == SUCCESS &&
+        php_driver_future_wait_timed(futures[i], timeout TSRMLS_CC) == SUCCESS &&
+        php_driver_future_is_error(futures[i] TSRMLS_CC) == SUCCESS) {
+      php_driver_prepared_cache_add(psession->prepared_cache, keys[i], futures[i]);
+    } else {
+      cass_future_free(futures[i]);
+      rc = FAILURE;
+    }
+    zend_string_release(keys[i]);
+  }
+
+  efree(futures);
+  efree(keys);
+
+  return rc;
+}
+
 PHP_METHOD(DefaultCluster, connect)
 {
   char *keyspace = NULL;
@@ -52,82 +185,74 @@ PHP_METHOD(DefaultCluster, connect)
 
   session->default_consistency = self->default_consistency;
   session->default_page_size   = self->default_page_size;
+  session->default_native_types = self->default_native_types;
+  session->auto_prepare        = self->auto_prepare;
   session->persist             = self->persist;
 
-  if (!PHP5TO7_ZVAL_IS_UNDEF(session->default_timeout)) {
+  if (!PHP5TO7_ZVAL_IS_UNDEF(self->default_timeout)) {
     PHP5TO7_ZVAL_COPY(PHP5TO7_ZVAL_MAYBE_P(session->default_timeout),
                       PHP5TO7_ZVAL_MAYBE_P(self->default_timeout));
   }
 
   if (session->persist) {
-    php5to7_zend_resource_le *le;
-
-    hash_key_len = spprintf(&hash_key, 0, "%s:session:%s",
-                            self->hash_key, SAFE_STR(keyspace));
+    psession = persistent_session(self, keyspace, &hash_key, &hash_key_len TSRMLS_CC);
+    session->session = php_driver_add_ref(psession->session);
+    if (psession->prepared_cache)
+      session->prepared_cache = php_driver_add_ref(psession->prepared_cache);
 
-    if (PHP5TO7_ZEND_HASH_FIND(&EG(persistent_list), hash_key, hash_key_len + 1, le) &&
-        Z_RES_P(le)->type == php_le_php_driver_session()) {
-      psession = (php_driver_psession *) Z_RES_P(le)->ptr;
-      session->session = php_driver_add_ref(psession->session);
-      future = psession->future;
-    }
+    wait_persistent_session(psession, hash_key, hash_key_len, timeout TSRMLS_CC);
+    return;
   }
 
-  if (future == NULL) {
-    php5to7_zend_resource_le resource;
+  session->session = php_driver_new_peref(cass_session_new(), free_session, 1);
+  future = connect_session(self, session->session, keyspace);
 
-    session->session = php_driver_new_peref(cass_session_new(), free_session, 1);
+  /* Auto-prepared queries are only cached for the session's lifetime */
+  if (self->auto_prepare)
+    session->prepared_cache = php_driver_prepared_cache_new(keyspace);
 
-    if (keyspace) {
-      future = cass_session_connect_keyspace((CassSession *) session->session->data,
-                                             self->cluster,
-                                             keyspace);
-    } else {
-      future = cass_session_connect((CassSession *) session->session->data,
-                                    self->cluster);
-    }
+  if (php_driver_future_wait_timed(future, timeout TSRMLS_CC) == SUCCESS)
+    php_driver_future_is_error(future TSRMLS_CC);
 
-    if (session->persist) {
-      psession = (php_driver_psession *) pecalloc(1, sizeof(php_driver_psession), 1);
-      psession->session = php_driver_add_ref(session->session);
-      psession->future  = future;
-
-#if PHP_MAJOR_VERSION >= 7
-      ZVAL_NEW_PERSISTENT_RES(&resource, 0, psession, php_le_php_driver_session());
-      PHP5TO7_ZEND_HASH_UPDATE(&EG(persistent_list), hash_key, hash_key_len + 1, &resource, sizeof(php5to7_zend_resource_le));
-      PHP_DRIVER_G(persistent_sessions)++;
-#else
-      resource.type = php_le_php_driver_session();
-      resource.ptr = psession;
-      PHP5TO7_ZEND_HASH_UPDATE(&EG(persistent_list), hash_key, hash_key_len + 1, resource, sizeof(php5to7_zend_resource_le));
-      PHP_DRIVER_G(persistent_sessions)++;
-#endif
-    }
-  }
+  cass_future_free(future);
+}
 
-  if (php_driver_future_wait_timed(future, timeout TSRMLS_CC) == FAILURE) {
-    if (session->persist) {
-      efree(hash_key);
-    } else {
-      cass_future_free(future);
-    }
+PHP_METHOD(DefaultCluster, preload)
+{
+  HashTable *keyspaces;
+  zval *timeout = NULL;
+  php_driver_cluster *self = NULL;
+  zend_string *keyspace;
+  zval *queries;
 
+  if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "h|z", &keyspaces, &timeout) == FAILURE) {
     return;
   }
 
-  if (php_driver_future_is_error(future TSRMLS_CC) == FAILURE) {
-    if (session->persist) {
-      (void) PHP5TO7_ZEND_HASH_DEL(&EG(persistent_list), hash_key, hash_key_len + 1);
-      efree(hash_key);
-    } else {
-      cass_future_free(future);
+  self = PHP_DRIVER_GET_CLUSTER(getThis());
+
+  ZEND_HASH_FOREACH_VAL(keyspaces, queries) {
+    if (Z_TYPE_P(queries) != IS_ARRAY) {
+      INVALID_ARGUMENT(queries, "an array of queries");
     }
+  } ZEND_HASH_FOREACH_END();
 
+  /* Nothing outlives the request without persistent sessions */
+  if (!self->persist)
     return;
-  }
 
-  if (session->persist)
-    efree(hash_key);
+  /* Integer keys and empty names preload sessions without a keyspace */
+  ZEND_HASH_FOREACH_STR_KEY_VAL(keyspaces, keyspace, queries) {
+    const char *name = keyspace && ZSTR_LEN(keyspace) > 0 ? ZSTR_VAL(keyspace) : NULL;
+    php_driver_psession *psession;
+    char *hash_key;
+    php5to7_size hash_key_len;
+
+    psession = persistent_session(self, name, &hash_key, &hash_key_len TSRMLS_CC);
+    if (wait_persistent_session(psession, hash_key, hash_key_len, timeout TSRMLS_CC) == FAILURE ||
+        preload_statements(psession, Z_ARRVAL_P(queries), timeout TSRMLS_CC) == FAILURE)
+      return;
+  } ZEND_HASH_FOREACH_END();
 }
 
 PHP_METHOD(DefaultCluster, connectAsync)
@@ -148,7 +273,8 @@ PHP_METHOD(DefaultCluster, connectAsync)
   object_init_ex(return_value, php_driver_future_session_ce);
   future = PHP_DRIVER_GET_FUTURE_SESSION(return_value);
 
-  future->persist = self->persist;
+  future->persist      = self->persist;
+  future->auto_prepare = self->auto_prepare;
 
   if (self->persist) {
     php5to7_zend_resource_le *le;
@@ -164,6 +290,8 @@ PHP_METHOD(DefaultCluster, connectAsync)
       php_driver_psession *psession = (php_driver_psession *) Z_RES_P(le)->ptr;
       future->session = php_driver_add_ref(psession->session);
       future->future  = psession->future;
+      if (psession->prepared_cache)
+        future->prepared_cache = php_driver_add_ref(psession->prepared_cache);
       return;
     }
   }
@@ -179,12 +307,18 @@ PHP_METHOD(DefaultCluster, connectAsync)
                                           self->cluster);
   }
 
+  if (!self->persist && self->auto_prepare)
+    future->prepared_cache = php_driver_prepared_cache_new(keyspace);
+
   if (self->persist) {
     php5to7_zend_resource_le resource;
     php_driver_psession *psession =
       (php_driver_psession *) pecalloc(1, sizeof(php_driver_psession), 1);
     psession->session = php_driver_add_ref(future->session);
     psession->future  = future->future;
+    psession->prepared_cache = php_driver_prepared_cache_new(keyspace);
+    if (psession->prepared_cache)
+      future->prepared_cache = php_driver_add_ref(psession->prepared_cache);
 
 #if PHP_MAJOR_VERSION >= 7
     ZVAL_NEW_PERSISTENT_RES(&resource, 0, psession, php_le_php_driver_session());
@@ -209,9 +343,15 @@ ZEND_BEGIN_ARG_INFO_EX(arginfo_connectAsync, 0, ZEND_RETURN_VALUE, 0)
   ZEND_ARG_INFO(0, keyspace)
 ZEND_END_ARG_INFO()
 
+ZEND_BEGIN_ARG_INFO_EX(arginfo_preload, 0, ZEND_RETURN_VALUE, 1)
+  ZEND_ARG_ARRAY_INFO(0, keyspaces, 0)
+  ZEND_ARG_INFO(0, timeout)
+ZEND_END_ARG_INFO()
+
 static zend_function_entry php_driver_default_cluster_methods[] = {
   PHP_ME(DefaultCluster, connect, arginfo_connect, ZEND_ACC_PUBLIC)
   PHP_ME(DefaultCluster, connectAsync, arginfo_connectAsync, ZEND_ACC_PUBLIC)
+  PHP_ME(DefaultCluster, preload, arginfo_preload, ZEND_ACC_PUBLIC)
   PHP_FE_END
 };
 
@@ -291,6 +431,8 @@ php_driver_default_cluster_new(zend_class_entry *ce TSRMLS_DC)
   self->cluster             = NULL;
   self->default_consistency = PHP_DRIVER_DEFAULT_CONSISTENCY;
   self->default_page_size   = 5000;
+  self->default_native_types = cass_false;
+  self->auto_prepare        = 0;
   self->persist             = 0;
   self->hash_key            = NULL;
 
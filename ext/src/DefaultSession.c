@@ -16,22 +16,18 @@
 
 #include "php_driver.h"
 #include "php_driver_types.h"
+#include "util/bind.h"
 #include "util/bytes.h"
 #include "util/future.h"
+#include "util/prepared_cache.h"
 #include "util/result.h"
 #include "util/ref.h"
-#include "util/math.h"
-#include "util/collections.h"
+#include "BoundStatement.h"
 #include "ExecutionOptions.h"
+#include "Rows.h"
 
 zend_class_entry *php_driver_default_session_ce = NULL;
 
-#define CHECK_RESULT(rc) \
-{ \
-  ASSERT_SUCCESS_VALUE(rc, FAILURE) \
-  return SUCCESS; \
-}
-
 static void
 free_result(void *result)
 {
@@ -50,361 +46,6 @@ free_schema(void *schema)
   cass_schema_meta_free((CassSchemaMeta *) schema);
 }
 
-static int
-bind_argument_by_index(CassStatement *statement, size_t index, zval *value TSRMLS_DC)
-{
-  if (Z_TYPE_P(value) == IS_NULL)
-    CHECK_RESULT(cass_statement_bind_null(statement, index));
-
-  if (Z_TYPE_P(value) == IS_STRING)
-    CHECK_RESULT(cass_statement_bind_string(statement, index, Z_STRVAL_P(value)));
-
-  if (Z_TYPE_P(value) == IS_DOUBLE)
-    CHECK_RESULT(cass_statement_bind_double(statement, index, Z_DVAL_P(value)));
-
-  if (Z_TYPE_P(value) == IS_LONG)
-    CHECK_RESULT(cass_statement_bind_int32(statement, index, Z_LVAL_P(value)));
-
-  if (PHP5TO7_ZVAL_IS_TRUE_P(value))
-    CHECK_RESULT(cass_statement_bind_bool(statement, index, cass_true));
-
-  if (PHP5TO7_ZVAL_IS_FALSE_P(value))
-    CHECK_RESULT(cass_statement_bind_bool(statement, index, cass_false));
-
-  if (Z_TYPE_P(value) == IS_OBJECT) {
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_float_ce TSRMLS_CC)) {
-      php_driver_numeric *float_number = PHP_DRIVER_GET_NUMERIC(value);
-      CHECK_RESULT(cass_statement_bind_float(statement, index, float_number->data.floating.value));
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_bigint_ce TSRMLS_CC)) {
-      php_driver_numeric *bigint = PHP_DRIVER_GET_NUMERIC(value);
-      CHECK_RESULT(cass_statement_bind_int64(statement, index, bigint->data.bigint.value));
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_smallint_ce TSRMLS_CC)) {
-      php_driver_numeric *smallint = PHP_DRIVER_GET_NUMERIC(value);
-      CHECK_RESULT(cass_statement_bind_int16(statement, index, smallint->data.smallint.value));
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_tinyint_ce TSRMLS_CC)) {
-      php_driver_numeric *tinyint = PHP_DRIVER_GET_NUMERIC(value);
-      CHECK_RESULT(cass_statement_bind_int8(statement, index, tinyint->data.tinyint.value));
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_timestamp_ce TSRMLS_CC)) {
-      php_driver_timestamp *timestamp = PHP_DRIVER_GET_TIMESTAMP(value);
-      CHECK_RESULT(cass_statement_bind_int64(statement, index, timestamp->timestamp));
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_date_ce TSRMLS_CC)) {
-      php_driver_date *date = PHP_DRIVER_GET_DATE(value);
-      CHECK_RESULT(cass_statement_bind_uint32(statement, index, date->date));
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_time_ce TSRMLS_CC)) {
-      php_driver_time *time = PHP_DRIVER_GET_TIME(value);
-      CHECK_RESULT(cass_statement_bind_int64(statement, index, time->time));
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_blob_ce TSRMLS_CC)) {
-      php_driver_blob *blob = PHP_DRIVER_GET_BLOB(value);
-      CHECK_RESULT(cass_statement_bind_bytes(statement, index, blob->data, blob->size));
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_varint_ce TSRMLS_CC)) {
-      php_driver_numeric *varint = PHP_DRIVER_GET_NUMERIC(value);
-      size_t size;
-      cass_byte_t *data = export_twos_complement(varint->data.varint.value, &size);
-      CassError rc = cass_statement_bind_bytes(statement, index, data, size);
-      free(data);
-      CHECK_RESULT(rc);
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_decimal_ce TSRMLS_CC)) {
-      php_driver_numeric *decimal = PHP_DRIVER_GET_NUMERIC(value);
-      size_t size;
-      cass_byte_t *data = (cass_byte_t *) export_twos_complement(decimal->data.decimal.value, &size);
-      CassError rc = cass_statement_bind_decimal(statement, index, data, size, decimal->data.decimal.scale);
-      free(data);
-      CHECK_RESULT(rc);
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_uuid_interface_ce TSRMLS_CC)) {
-      php_driver_uuid *uuid = PHP_DRIVER_GET_UUID(value);
-      CHECK_RESULT(cass_statement_bind_uuid(statement, index, uuid->uuid));
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_inet_ce TSRMLS_CC)) {
-      php_driver_inet *inet = PHP_DRIVER_GET_INET(value);
-      CHECK_RESULT(cass_statement_bind_inet(statement, index, inet->inet));
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_duration_ce TSRMLS_CC)) {
-      php_driver_duration *duration = PHP_DRIVER_GET_DURATION(value);
-      CHECK_RESULT(cass_statement_bind_duration(statement,
-                                                index,
-                                                duration->months, duration->days, duration->nanos));
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_set_ce TSRMLS_CC)) {
-      CassError rc;
-      CassCollection *collection;
-      php_driver_set *set = PHP_DRIVER_GET_SET(value);
-      if (!php_driver_collection_from_set(set, &collection TSRMLS_CC))
-        return FAILURE;
-
-      rc = cass_statement_bind_collection(statement, index, collection);
-      cass_collection_free(collection);
-      CHECK_RESULT(rc);
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_map_ce TSRMLS_CC)) {
-      CassError rc;
-      CassCollection *collection;
-      php_driver_map *map = PHP_DRIVER_GET_MAP(value);
-      if (!php_driver_collection_from_map(map, &collection TSRMLS_CC))
-        return FAILURE;
-
-      rc = cass_statement_bind_collection(statement, index, collection);
-      cass_collection_free(collection);
-      CHECK_RESULT(rc);
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_collection_ce TSRMLS_CC)) {
-      CassError rc;
-      CassCollection *collection;
-      php_driver_collection *coll = PHP_DRIVER_GET_COLLECTION(value);
-      if (!php_driver_collection_from_collection(coll, &collection TSRMLS_CC))
-        return FAILURE;
-
-      rc = cass_statement_bind_collection(statement, index, collection);
-      cass_collection_free(collection);
-      CHECK_RESULT(rc);
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_tuple_ce TSRMLS_CC)) {
-      CassError rc;
-      CassTuple *tup;
-      php_driver_tuple *tuple = PHP_DRIVER_GET_TUPLE(value);
-      if (!php_driver_tuple_from_tuple(tuple, &tup TSRMLS_CC))
-        return FAILURE;
-
-      rc = cass_statement_bind_tuple(statement, index, tup);
-      cass_tuple_free(tup);
-      CHECK_RESULT(rc);
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_user_type_value_ce TSRMLS_CC)) {
-      CassError rc;
-      CassUserType *ut;
-      php_driver_user_type_value *user_type_value = PHP_DRIVER_GET_USER_TYPE_VALUE(value);
-      if (!php_driver_user_type_from_user_type_value(user_type_value, &ut TSRMLS_CC))
-        return FAILURE;
-
-      rc = cass_statement_bind_user_type(statement, index, ut);
-      cass_user_type_free(ut);
-      CHECK_RESULT(rc);
-    }
-  }
-
-  return FAILURE;
-}
-
-static int
-bind_argument_by_name(CassStatement *statement, const char *name,
-                      zval *value TSRMLS_DC)
-{
-  if (Z_TYPE_P(value) == IS_NULL) {
-    CHECK_RESULT(cass_statement_bind_null_by_name(statement, name));
-  }
-
-  if (Z_TYPE_P(value) == IS_STRING)
-    CHECK_RESULT(cass_statement_bind_string_by_name(statement, name, Z_STRVAL_P(value)));
-
-  if (Z_TYPE_P(value) == IS_DOUBLE)
-    CHECK_RESULT(cass_statement_bind_double_by_name(statement, name, Z_DVAL_P(value)));
-
-  if (Z_TYPE_P(value) == IS_LONG)
-    CHECK_RESULT(cass_statement_bind_int32_by_name(statement, name, Z_LVAL_P(value)));
-
-  if (PHP5TO7_ZVAL_IS_TRUE_P(value))
-    CHECK_RESULT(cass_statement_bind_bool_by_name(statement, name, cass_true));
-
-  if (PHP5TO7_ZVAL_IS_FALSE_P(value))
-    CHECK_RESULT(cass_statement_bind_bool_by_name(statement, name, cass_false));
-
-  if (Z_TYPE_P(value) == IS_OBJECT) {
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_float_ce TSRMLS_CC)) {
-      php_driver_numeric *float_number = PHP_DRIVER_GET_NUMERIC(value);
-      CHECK_RESULT(cass_statement_bind_float_by_name(statement, name, float_number->data.floating.value));
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_bigint_ce TSRMLS_CC)) {
-      php_driver_numeric *bigint = PHP_DRIVER_GET_NUMERIC(value);
-      CHECK_RESULT(cass_statement_bind_int64_by_name(statement, name, bigint->data.bigint.value));
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_smallint_ce TSRMLS_CC)) {
-      php_driver_numeric *smallint = PHP_DRIVER_GET_NUMERIC(value);
-      CHECK_RESULT(cass_statement_bind_int16_by_name(statement, name, smallint->data.smallint.value));
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_tinyint_ce TSRMLS_CC)) {
-      php_driver_numeric *tinyint = PHP_DRIVER_GET_NUMERIC(value);
-      CHECK_RESULT(cass_statement_bind_int8_by_name(statement, name, tinyint->data.tinyint.value));
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_timestamp_ce TSRMLS_CC)) {
-      php_driver_timestamp *timestamp = PHP_DRIVER_GET_TIMESTAMP(value);
-      CHECK_RESULT(cass_statement_bind_int64_by_name(statement, name, timestamp->timestamp));
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_date_ce TSRMLS_CC)) {
-      php_driver_date *date = PHP_DRIVER_GET_DATE(value);
-      CHECK_RESULT(cass_statement_bind_uint32_by_name(statement, name, date->date));
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_time_ce TSRMLS_CC)) {
-      php_driver_time *time = PHP_DRIVER_GET_TIME(value);
-      CHECK_RESULT(cass_statement_bind_int64_by_name(statement, name, time->time));
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_blob_ce TSRMLS_CC)) {
-      php_driver_blob *blob = PHP_DRIVER_GET_BLOB(value);
-      CHECK_RESULT(cass_statement_bind_bytes_by_name(statement, name, blob->data, blob->size));
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_varint_ce TSRMLS_CC)) {
-      php_driver_numeric *varint = PHP_DRIVER_GET_NUMERIC(value);
-      size_t size;
-      cass_byte_t *data = (cass_byte_t *) export_twos_complement(varint->data.varint.value, &size);
-      CassError rc = cass_statement_bind_bytes_by_name(statement, name, data, size);
-      free(data);
-      CHECK_RESULT(rc);
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_decimal_ce TSRMLS_CC)) {
-      php_driver_numeric *decimal = PHP_DRIVER_GET_NUMERIC(value);
-      size_t size;
-      cass_byte_t *data = (cass_byte_t *) export_twos_complement(decimal->data.decimal.value, &size);
-      CassError rc = cass_statement_bind_decimal_by_name(statement, name, data, size, decimal->data.decimal.scale);
-      free(data);
-      CHECK_RESULT(rc);
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_uuid_interface_ce TSRMLS_CC)) {
-      php_driver_uuid *uuid = PHP_DRIVER_GET_UUID(value);
-      CHECK_RESULT(cass_statement_bind_uuid_by_name(statement, name, uuid->uuid));
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_inet_ce TSRMLS_CC)) {
-      php_driver_inet *inet = PHP_DRIVER_GET_INET(value);
-      CHECK_RESULT(cass_statement_bind_inet_by_name(statement, name, inet->inet));
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_duration_ce TSRMLS_CC)) {
-      php_driver_duration *duration = PHP_DRIVER_GET_DURATION(value);
-      CHECK_RESULT(cass_statement_bind_duration_by_name(statement,
-                                                        name,
-                                                        duration->months, duration->days, duration->nanos));
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_set_ce TSRMLS_CC)) {
-      CassError rc;
-      CassCollection *collection;
-      php_driver_set *set = PHP_DRIVER_GET_SET(value);
-      if (!php_driver_collection_from_set(set, &collection TSRMLS_CC))
-        return FAILURE;
-
-      rc = cass_statement_bind_collection_by_name(statement, name, collection);
-      cass_collection_free(collection);
-      CHECK_RESULT(rc);
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_map_ce TSRMLS_CC)) {
-      CassError rc;
-      CassCollection *collection;
-      php_driver_map *map = PHP_DRIVER_GET_MAP(value);
-      if (!php_driver_collection_from_map(map, &collection TSRMLS_CC))
-        return FAILURE;
-
-      rc = cass_statement_bind_collection_by_name(statement, name, collection);
-      cass_collection_free(collection);
-      CHECK_RESULT(rc);
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_collection_ce TSRMLS_CC)) {
-      CassError rc;
-      CassCollection *collection;
-      php_driver_collection *coll = PHP_DRIVER_GET_COLLECTION(value);
-      if (!php_driver_collection_from_collection(coll, &collection TSRMLS_CC))
-        return FAILURE;
-
-      rc = cass_statement_bind_collection_by_name(statement, name, collection);
-      cass_collection_free(collection);
-      CHECK_RESULT(rc);
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_tuple_ce TSRMLS_CC)) {
-      CassError rc;
-      CassTuple *tup;
-      php_driver_tuple *tuple = PHP_DRIVER_GET_TUPLE(value);
-      if (!php_driver_tuple_from_tuple(tuple, &tup TSRMLS_CC))
-        return FAILURE;
-
-      rc = cass_statement_bind_tuple_by_name(statement, name, tup);
-      cass_tuple_free(tup);
-      CHECK_RESULT(rc);
-    }
-
-    if (instanceof_function(Z_OBJCE_P(value), php_driver_user_type_value_ce TSRMLS_CC)) {
-      CassError rc;
-      CassUserType *ut;
-      php_driver_user_type_value *user_type_value = PHP_DRIVER_GET_USER_TYPE_VALUE(value);
-      if (!php_driver_user_type_from_user_type_value(user_type_value, &ut TSRMLS_CC))
-        return FAILURE;
-
-      rc = cass_statement_bind_user_type_by_name(statement, name, ut);
-      cass_user_type_free(ut);
-      CHECK_RESULT(rc);
-    }
-  }
-
-  return FAILURE;
-}
-
-static int
-bind_arguments(CassStatement *statement, HashTable *arguments TSRMLS_DC)
-{
-  int rc = SUCCESS;
-
-  php5to7_zval *current;
-  ulong num_key;
-
-#if PHP_MAJOR_VERSION >= 7
-  zend_string *key;
-  ZEND_HASH_FOREACH_KEY_VAL(arguments, num_key, key, current) {
-    if (key) {
-      rc = bind_argument_by_name(statement, key->val,
-                                 PHP5TO7_ZVAL_MAYBE_DEREF(current) TSRMLS_CC);
-#else
-  char *str_key;
-  uint str_len;
-  PHP5TO7_ZEND_HASH_FOREACH_KEY_VAL(arguments, num_key, str_key, str_len, current) {
-    if (str_key) {
-      rc = bind_argument_by_name(statement, str_key,
-                                 PHP5TO7_ZVAL_MAYBE_DEREF(current) TSRMLS_CC);
-#endif
-    } else {
-      rc = bind_argument_by_index(statement, num_key, PHP5TO7_ZVAL_MAYBE_DEREF(current) TSRMLS_CC);
-    }
-    if (rc == FAILURE) break;
-  } PHP5TO7_ZEND_HASH_FOREACH_END(arguments);
-
-  return rc;
-}
-
 static CassStatement *
 create_statement(php_driver_statement *statement, HashTable *arguments TSRMLS_DC)
 {
@@ -423,13 +64,15 @@ create_statement(php_driver_statement *statement, HashTable *arguments TSRMLS_DC
   case PHP_DRIVER_PREPARED_STATEMENT:
     stmt = cass_prepared_bind(statement->data.prepared.prepared);
     break;
+  case PHP_DRIVER_BOUND_STATEMENT:
+    return php_driver_bound_statement_bind(statement, arguments TSRMLS_CC);
   default:
     zend_throw_exception_ex(php_driver_runtime_exception_ce, 0 TSRMLS_CC,
       "Unsupported statement type.");
     return NULL;
   }
 
-  if (arguments && bind_arguments(stmt, arguments TSRMLS_CC) == FAILURE) {
+  if (arguments && php_driver_bind_arguments(stmt, statement, arguments TSRMLS_CC) == FAILURE) {
     cass_statement_free(stmt);
     return NULL;
   }
@@ -441,7 +84,10 @@ static CassBatch *
 create_batch(php_driver_statement *batch,
              CassConsistency consistency,
              CassRetryPolicy *retry_policy,
-             cass_int64_t timestamp TSRMLS_DC)
+             cass_int64_t timestamp,
+             const char *profile,
+             size_t profile_size,
+             cass_uint64_t request_timeout TSRMLS_DC)
 {
   CassBatch *cass_batch = cass_batch_new(batch->data.batch.type);
   CassError rc = CASS_OK;
@@ -498,49 +144,365 @@ create_batch(php_driver_statement *batch,
     return NULL;
   )
 
+  rc = cass_batch_set_request_timeout(cass_batch, request_timeout);
+  ASSERT_SUCCESS_BLOCK(rc,
+    cass_batch_free(cass_batch);
+    return NULL;
+  )
+
+  if (profile) {
+    rc = cass_batch_set_execution_profile_n(cass_batch, profile, profile_size);
+    ASSERT_SUCCESS_BLOCK(rc,
+      cass_batch_free(cass_batch);
+      return NULL;
+    )
+  }
+
   return cass_batch;
 }
 
-static CassStatement *
-create_single(php_driver_statement *statement, HashTable *arguments,
-              CassConsistency consistency, long serial_consistency,
-              int page_size, const char* paging_state_token,
-              size_t paging_state_token_size,
-              CassRetryPolicy *retry_policy, cass_int64_t timestamp TSRMLS_DC)
+/* Options of an execution, on top of the defaults of the session */
+typedef struct {
+  HashTable *arguments;
+  CassConsistency consistency;
+  long serial_consistency;
+  int page_size;
+  char *paging_state_token;
+  size_t paging_state_token_size;
+  char *profile;
+  size_t profile_size;
+  zval *timeout;
+  uint64_t deadline;
+  cass_uint64_t request_timeout;
+  CassRetryPolicy *retry_policy;
+  cass_int64_t timestamp;
+  int concurrency;
+  zval *callback;
+  php_driver_result_options *result_options;
+  php_driver_execution_options local;
+} execution_options;
+
+static int
+get_execution_options(php_driver_session *self, zval *options,
+                      execution_options *execution TSRMLS_DC)
 {
-  CassError rc = CASS_OK;
-  CassStatement *stmt = create_statement(statement, arguments TSRMLS_CC);
-  if (!stmt)
-    return NULL;
+  php_driver_execution_options *opts = NULL;
+  zval *request_timeout = NULL;
+
+  execution->arguments               = NULL;
+  execution->consistency             = (CassConsistency) self->default_consistency;
+  execution->serial_consistency      = -1;
+  execution->page_size               = self->default_page_size;
+  execution->paging_state_token      = NULL;
+  execution->paging_state_token_size = 0;
+  execution->profile                 = NULL;
+  execution->profile_size            = 0;
+  execution->timeout                 = PHP5TO7_ZVAL_MAYBE_P(self->default_timeout);
+  execution->deadline                = 0;
+  execution->retry_policy            = NULL;
+  execution->timestamp               = INT64_MIN;
+  execution->concurrency             = PHP_DRIVER_DEFAULT_CONCURRENCY;
+  execution->callback                = NULL;
+  execution->result_options          = NULL;
+
+  if (!options) {
+    execution->request_timeout = php_driver_future_request_timeout(execution->timeout, 0);
+    return SUCCESS;
+  }
 
-  rc = cass_statement_set_consistency(stmt, consistency);
+  request_timeout = execution->timeout;
 
-  if (rc == CASS_OK && serial_consistency >= 0)
-    rc = cass_statement_set_serial_consistency(stmt, serial_consistency);
+  if (Z_TYPE_P(options) != IS_ARRAY &&
+      (Z_TYPE_P(options) != IS_OBJECT || !instanceof_function(Z_OBJCE_P(options), php_driver_execution_options_ce TSRMLS_CC))) {
+    INVALID_ARGUMENT_VALUE(options, "an instance of " PHP_DRIVER_NAMESPACE "\\ExecutionOptions or an array or null", FAILURE);
+  }
+
+  if (Z_TYPE_P(options) == IS_OBJECT) {
+    opts = PHP_DRIVER_GET_EXECUTION_OPTIONS(options);
+  } else {
+    if (php_driver_execution_options_build_local_from_array(&execution->local, options TSRMLS_CC) == FAILURE) {
+      return FAILURE;
+    }
+    opts = &execution->local;
+  }
+
+  if (!PHP5TO7_ZVAL_IS_UNDEF(opts->arguments))
+    execution->arguments = PHP5TO7_Z_ARRVAL_MAYBE_P(opts->arguments);
+
+  /* Profiles supply the consistency unless it's set for the execution */
+  if (opts->profile) {
+    execution->profile      = opts->profile;
+    execution->profile_size = opts->profile_size;
+    execution->consistency  = CASS_CONSISTENCY_UNKNOWN;
+    request_timeout         = NULL;
+  }
+
+  if (opts->consistency >= 0)
+    execution->consistency = (CassConsistency) opts->consistency;
+
+  if (opts->page_size >= 0)
+    execution->page_size = opts->page_size;
+
+  if (opts->paging_state_token) {
+    execution->paging_state_token = opts->paging_state_token;
+    execution->paging_state_token_size = opts->paging_state_token_size;
+  }
+
+  if (!PHP5TO7_ZVAL_IS_UNDEF(opts->timeout)) {
+    execution->timeout = PHP5TO7_ZVAL_MAYBE_P(opts->timeout);
+    request_timeout    = execution->timeout;
+  }
+
+  /* The deadline is the budget of the execution and of the pages fetched
+   * after it */
+  if (!PHP5TO7_ZVAL_IS_UNDEF(opts->deadline)) {
+    cass_duration_t deadline_us;
+
+    if (php_driver_future_timeout(PHP5TO7_ZVAL_MAYBE_P(opts->deadline), &deadline_us TSRMLS_CC) == FAILURE)
+      return FAILURE;
+    execution->deadline = php_driver_future_deadline(deadline_us);
+  }
+
+  /* The driver gives up on the request when the application does, the
+   * session's default timeout leaves a profile's request timeout alone */
+  execution->request_timeout = php_driver_future_request_timeout(request_timeout,
+                                                                 execution->deadline);
+
+  if (opts->serial_consistency >= 0)
+    execution->serial_consistency = opts->serial_consistency;
+
+  if (!PHP5TO7_ZVAL_IS_UNDEF(opts->retry_policy))
+    execution->retry_policy = (PHP_DRIVER_GET_RETRY_POLICY(PHP5TO7_ZVAL_MAYBE_P(opts->retry_policy)))->policy;
+
+  if (opts->concurrency > 0)
+    execution->concurrency = opts->concurrency;
+
+  if (!PHP5TO7_ZVAL_IS_UNDEF(opts->callback))
+    execution->callback = PHP5TO7_ZVAL_MAYBE_P(opts->callback);
+
+  execution->timestamp = opts->timestamp;
+
+  execution->result_options = &opts->result;
+
+  return SUCCESS;
+}
+
+/* Sets every option of a statement, including the ones left to their
+ * defaults, as bound statements are executed more than once */
+static int
+set_statement_options(CassStatement *stmt, const execution_options *options TSRMLS_DC)
+{
+  CassError rc = cass_statement_set_consistency(stmt, options->consistency);
+
+  if (rc == CASS_OK) {
+    rc = cass_statement_set_serial_consistency(stmt,
+                                               options->serial_consistency >= 0
+                                               ? (CassConsistency) options->serial_consistency
+                                               : CASS_CONSISTENCY_UNKNOWN);
+  }
 
-  if (rc == CASS_OK && page_size >= 0)
-    rc = cass_statement_set_paging_size(stmt, page_size);
+  if (rc == CASS_OK)
+    rc = cass_statement_set_paging_size(stmt, options->page_size);
 
-  if (rc == CASS_OK && paging_state_token) {
+  if (rc == CASS_OK) {
     rc = cass_statement_set_paging_state_token(stmt,
-                                               paging_state_token,
-                                               paging_state_token_size);
+                                               options->paging_state_token
+                                               ? options->paging_state_token : "",
+                                               options->paging_state_token_size);
   }
 
-  if (rc == CASS_OK && retry_policy)
-    rc = cass_statement_set_retry_policy(stmt, retry_policy);
+  if (rc == CASS_OK)
+    rc = cass_statement_set_retry_policy(stmt, options->retry_policy);
+
+  if (rc == CASS_OK)
+    rc = cass_statement_set_timestamp(stmt, options->timestamp);
 
   if (rc == CASS_OK)
-    rc = cass_statement_set_timestamp(stmt, timestamp);
+    rc = cass_statement_set_request_timeout(stmt, options->request_timeout);
+
+  /* An empty name resets the statement to the default profile */
+  if (rc == CASS_OK) {
+    rc = cass_statement_set_execution_profile_n(stmt,
+                                                options->profile
+                                                ? options->profile : "",
+                                                options->profile_size);
+  }
 
   if (rc != CASS_OK) {
-    cass_statement_free(stmt);
     zend_throw_exception_ex(exception_class(rc), rc TSRMLS_CC,
                             "%s", cass_error_desc(rc));
+    return FAILURE;
+  }
+
+  return SUCCESS;
+}
+
+/* Executes a simple statement as the prepared statement of its query once
+ * the query was executed often enough, leaves the statement unset until then */
+static int
+create_auto_prepared(php_driver_session *self, php_driver_statement *statement,
+                     HashTable *arguments, CassStatement **stmt TSRMLS_DC)
+{
+  const char *cql = statement->data.simple.cql;
+  size_t cql_len = strlen(cql);
+  php_driver_statement prepared;
+  zend_string *key;
+
+  memset(&prepared, 0, sizeof(php_driver_statement));
+
+  key = php_driver_prepared_cache_key(self->prepared_cache, cql, cql_len);
+  prepared.data.prepared.prepared =
+    php_driver_prepared_cache_auto(self->prepared_cache,
+                                   (CassSession *) self->session->data,
+                                   key, cql, cql_len, self->auto_prepare);
+  zend_string_release(key);
+
+  if (!prepared.data.prepared.prepared)
+    return SUCCESS;
+
+  prepared.type = PHP_DRIVER_PREPARED_STATEMENT;
+  php_driver_bind_plan_init(&prepared);
+
+  *stmt = create_statement(&prepared, arguments TSRMLS_CC);
+
+  /* Bound statements keep what they need of the prepared statement */
+  php_driver_bind_plan_destroy(&prepared);
+  cass_prepared_free(prepared.data.prepared.prepared);
+
+  return *stmt ? SUCCESS : FAILURE;
+}
+
+/* Returns 1 when the statement is a USE query, along with the keyspace it
+ * switches the session to. Batches can't contain USE queries */
+static int
+statement_keyspace(php_driver_statement *statement,
+                   const char **keyspace, size_t *keyspace_len)
+{
+  switch (statement->type) {
+  case PHP_DRIVER_SIMPLE_STATEMENT:
+    return php_driver_prepared_cache_parse_use(statement->data.simple.cql,
+                                               strlen(statement->data.simple.cql),
+                                               keyspace, keyspace_len);
+  case PHP_DRIVER_BOUND_STATEMENT:
+    statement = PHP_DRIVER_GET_STATEMENT(PHP5TO7_ZVAL_MAYBE_P(statement->data.bound.prepared));
+    /* fall through */
+  case PHP_DRIVER_PREPARED_STATEMENT:
+    if (!statement->data.prepared.keyspace)
+      return 0;
+    *keyspace     = statement->data.prepared.keyspace;
+    *keyspace_len = strlen(statement->data.prepared.keyspace);
+    return 1;
+  default:
+    return 0;
+  }
+}
+
+/* Prepared statements are cached by keyspace, follows the session's keyspace
+ * once a USE query succeeded */
+static void
+follow_keyspace(php_driver_session *self, php_driver_statement *statement)
+{
+  const char *keyspace;
+  size_t keyspace_len;
+
+  if (self->prepared_cache && statement_keyspace(statement, &keyspace, &keyspace_len))
+    php_driver_prepared_cache_use(self->prepared_cache, keyspace, keyspace_len);
+}
+
+/* Returns the statement to execute, which is shared with the bound statement
+ * it comes from if any */
+static php_driver_ref *
+create_single(php_driver_session *self, php_driver_statement *statement,
+              HashTable *arguments, const execution_options *options TSRMLS_DC)
+{
+  php_driver_ref *single;
+  CassStatement *stmt = NULL;
+  const char *keyspace;
+  size_t keyspace_len;
+
+  if (self->prepared_cache && self->auto_prepare > 0 &&
+      statement->type == PHP_DRIVER_SIMPLE_STATEMENT &&
+      !statement_keyspace(statement, &keyspace, &keyspace_len)) {
+    if (create_auto_prepared(self, statement, arguments, &stmt TSRMLS_CC) == FAILURE)
+      return NULL;
+  }
+
+  if (stmt) {
+    single = php_driver_new_ref(stmt, free_statement);
+  } else if (statement->type == PHP_DRIVER_BOUND_STATEMENT) {
+    single = php_driver_bound_statement_acquire(statement, arguments TSRMLS_CC);
+  } else {
+    CassStatement *stmt = create_statement(statement, arguments TSRMLS_CC);
+    single = stmt ? php_driver_new_ref(stmt, free_statement) : NULL;
+  }
+
+  if (!single)
+    return NULL;
+
+  if (set_statement_options((CassStatement *) single->data, options TSRMLS_CC) == FAILURE) {
+    php_driver_del_ref(&single);
     return NULL;
   }
 
-  return stmt;
+  return single;
+}
+
+/* Waits for the result of an execution */
+static const CassResult *
+get_result(CassFuture *future, zval *timeout, uint64_t deadline TSRMLS_DC)
+{
+  const CassResult *result;
+
+  if (php_driver_future_wait_deadline(future, timeout, deadline TSRMLS_CC) == FAILURE ||
+      php_driver_future_is_error(future TSRMLS_CC) == FAILURE)
+    return NULL;
+
+  result = cass_future_get_result(future);
+  if (!result) {
+    zend_throw_exception_ex(php_driver_runtime_exception_ce, 0 TSRMLS_CC,
+                            "Future doesn't contain a result.");
+  }
+
+  return result;
+}
+
+/* Creates the rows of a result, which keep the statement when there are more
+ * pages to fetch */
+static int
+create_rows(php_driver_session *self, const CassResult *result,
+            php_driver_ref *statement, php_driver_result_options *result_options,
+            uint64_t deadline, zval *return_value TSRMLS_DC)
+{
+  php_driver_rows *rows = NULL;
+  php_driver_ref *page = php_driver_new_ref((void *) result, free_result);
+
+  object_init_ex(return_value, php_driver_rows_ce);
+  rows = PHP_DRIVER_GET_ROWS(return_value);
+
+  rows->options.native_types = self->default_native_types;
+  if (result_options)
+    php_driver_result_options_merge(&rows->options, result_options);
+
+  if (php_driver_result_options_lazy(&rows->options)) {
+    if (php_driver_rows_init_lazy(rows, page TSRMLS_CC) == FAILURE) {
+      php_driver_del_ref(&page);
+      return FAILURE;
+    }
+  } else if (php_driver_get_result(result, &rows->options, &rows->rows TSRMLS_CC) == FAILURE) {
+    php_driver_del_ref(&page);
+    return FAILURE;
+  }
+
+  if (statement && cass_result_has_more_pages(result)) {
+    rows->statement = php_driver_add_ref(statement);
+    rows->result    = page;
+    rows->session   = php_driver_add_ref(self->session);
+    rows->deadline  = deadline;
+    return SUCCESS;
+  }
+
+  php_driver_del_ref(&page);
+  return SUCCESS;
 }
 
 PHP_METHOD(DefaultSession, execute)
@@ -550,20 +512,11 @@ PHP_METHOD(DefaultSession, execute)
   php_driver_session *self = NULL;
   php_driver_statement *stmt = NULL;
   php_driver_statement simple_statement;
-  HashTable *arguments = NULL;
-  CassConsistency consistency = PHP_DRIVER_DEFAULT_CONSISTENCY;
-  int page_size = -1;
-  char *paging_state_token = NULL;
-  size_t paging_state_token_size = 0;
-  zval *timeout = NULL;
-  long serial_consistency = -1;
-  CassRetryPolicy *retry_policy = NULL;
-  cass_int64_t timestamp = INT64_MIN;
-  php_driver_execution_options *opts = NULL;
-  php_driver_execution_options local_opts;
+  execution_options opts;
   CassFuture *future = NULL;
-  CassStatement *single = NULL;
+  php_driver_ref *single = NULL;
   CassBatch *batch  = NULL;
+  const CassResult *result = NULL;
 
   if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z|z", &statement, &options) == FAILURE) {
     return;
@@ -582,126 +535,50 @@ PHP_METHOD(DefaultSession, execute)
     INVALID_ARGUMENT(statement, "a string or an instance of " PHP_DRIVER_NAMESPACE "\\Statement");
   }
 
-  consistency = self->default_consistency;
-  page_size = self->default_page_size;
-  timeout = PHP5TO7_ZVAL_MAYBE_P(self->default_timeout);
-
-  if (options) {
-    if (Z_TYPE_P(options) != IS_ARRAY &&
-        (Z_TYPE_P(options) != IS_OBJECT || !instanceof_function(Z_OBJCE_P(options), php_driver_execution_options_ce TSRMLS_CC))) {
-      INVALID_ARGUMENT(options, "an instance of " PHP_DRIVER_NAMESPACE "\\ExecutionOptions or an array or null");
-    }
-
-    if (Z_TYPE_P(options) == IS_OBJECT) {
-      opts = PHP_DRIVER_GET_EXECUTION_OPTIONS(options);
-    } else {
-      if (php_driver_execution_options_build_local_from_array(&local_opts, options TSRMLS_CC) == FAILURE) {
-        return;
-      }
-      opts = &local_opts;
-    }
-
-    if (!PHP5TO7_ZVAL_IS_UNDEF(opts->arguments))
-      arguments = PHP5TO7_Z_ARRVAL_MAYBE_P(opts->arguments);
-
-    if (opts->consistency >= 0)
-      consistency = (CassConsistency) opts->consistency;
-
-    if (opts->page_size >= 0)
-      page_size = opts->page_size;
-
-    if (opts->paging_state_token) {
-      paging_state_token = opts->paging_state_token;
-      paging_state_token_size = opts->paging_state_token_size;
-    }
-
-    if (!PHP5TO7_ZVAL_IS_UNDEF(opts->timeout))
-      timeout = PHP5TO7_ZVAL_MAYBE_P(opts->timeout);
-
-    if (opts->serial_consistency >= 0)
-      serial_consistency = opts->serial_consistency;
-
-    if (!PHP5TO7_ZVAL_IS_UNDEF(opts->retry_policy))
-      retry_policy = (PHP_DRIVER_GET_RETRY_POLICY(PHP5TO7_ZVAL_MAYBE_P(opts->retry_policy)))->policy;
-
-    timestamp = opts->timestamp;
-  }
+  if (get_execution_options(self, options, &opts TSRMLS_CC) == FAILURE)
+    return;
 
   switch (stmt->type) {
     case PHP_DRIVER_SIMPLE_STATEMENT:
     case PHP_DRIVER_PREPARED_STATEMENT:
-      single = create_single(stmt, arguments, consistency,
-                             serial_consistency, page_size,
-                             paging_state_token, paging_state_token_size,
-                             retry_policy, timestamp TSRMLS_CC);
+    case PHP_DRIVER_BOUND_STATEMENT:
+      single = create_single(self, stmt, opts.arguments, &opts TSRMLS_CC);
 
       if (!single)
         return;
 
-      future = cass_session_execute((CassSession *) self->session->data, single);
+      future = cass_session_execute((CassSession *) self->session->data,
+                                    (CassStatement *) single->data);
       break;
     case PHP_DRIVER_BATCH_STATEMENT:
-      batch = create_batch(stmt, consistency, retry_policy, timestamp TSRMLS_CC);
+      batch = create_batch(stmt, opts.consistency, opts.retry_policy, opts.timestamp,
+                           opts.profile, opts.profile_size, opts.request_timeout TSRMLS_CC);
 
       if (!batch)
         return;
 
       future = cass_session_execute_batch((CassSession *) self->session->data, batch);
+      cass_batch_free(batch);
       break;
     default:
       INVALID_ARGUMENT(statement,
         "an instance of " PHP_DRIVER_NAMESPACE "\\SimpleStatement, " \
-        PHP_DRIVER_NAMESPACE "\\PreparedStatement or " PHP_DRIVER_NAMESPACE "\\BatchStatement"
+        PHP_DRIVER_NAMESPACE "\\PreparedStatement, " PHP_DRIVER_NAMESPACE "\\BoundStatement or " \
+        PHP_DRIVER_NAMESPACE "\\BatchStatement"
       );
       return;
   }
 
-  do {
-    const CassResult *result = NULL;
-    php_driver_rows *rows = NULL;
-
-    if (php_driver_future_wait_timed(future, timeout TSRMLS_CC) == FAILURE ||
-        php_driver_future_is_error(future TSRMLS_CC) == FAILURE) {
-      /* Ensure future is freed on error path to avoid resource leaks */
-      if (future) {
-        cass_future_free(future);
-        future = NULL;
-      }
-      break;
-    }
-
-    result = cass_future_get_result(future);
-    cass_future_free(future);
-    
-    if (!result) {
-      zend_throw_exception_ex(php_driver_runtime_exception_ce, 0 TSRMLS_CC,
-                              "Future doesn't contain a result.");
-      break;
-    }
-
-    object_init_ex(return_value, php_driver_rows_ce);
-    rows = PHP_DRIVER_GET_ROWS(return_value);
-
-    if (php_driver_get_result(result, &rows->rows TSRMLS_CC) == FAILURE) {
-      cass_result_free(result);
-      break;
-    }
+  result = get_result(future, opts.timeout, opts.deadline TSRMLS_CC);
+  php_driver_future_release(future, single TSRMLS_CC);
 
-    if (single && cass_result_has_more_pages(result)) {
-      rows->statement = php_driver_new_ref(single, free_statement);
-      rows->result    = php_driver_new_ref((void *)result, free_result);
-      rows->session   = php_driver_add_ref(self->session);
-      return;
-    }
-
-    cass_result_free(result);
-  } while (0);
-
-  if (batch)
-    cass_batch_free(batch);
+  if (result) {
+    follow_keyspace(self, stmt);
+    create_rows(self, result, single, opts.result_options, opts.deadline, return_value TSRMLS_CC);
+  }
 
   if (single)
-    cass_statement_free(single);
+    php_driver_del_ref(&single);
 }
 
 PHP_METHOD(DefaultSession, executeAsync)
@@ -711,19 +588,12 @@ PHP_METHOD(DefaultSession, executeAsync)
   php_driver_session *self = NULL;
   php_driver_statement *stmt = NULL;
   php_driver_statement simple_statement;
-  HashTable *arguments = NULL;
-  CassConsistency consistency = PHP_DRIVER_DEFAULT_CONSISTENCY;
-  int page_size = -1;
-  char *paging_state_token = NULL;
-  size_t paging_state_token_size = 0;
-  long serial_consistency = -1;
-  CassRetryPolicy *retry_policy = NULL;
-  cass_int64_t timestamp = INT64_MIN;
-  php_driver_execution_options *opts = NULL;
-  php_driver_execution_options local_opts;
+  execution_options opts;
   php_driver_future_rows *future_rows = NULL;
-  CassStatement *single = NULL;
+  php_driver_ref *single = NULL;
   CassBatch *batch  = NULL;
+  const char *keyspace;
+  size_t keyspace_len;
 
   if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z|z", &statement, &options) == FAILURE) {
     return;
@@ -742,67 +612,38 @@ PHP_METHOD(DefaultSession, executeAsync)
     INVALID_ARGUMENT(statement, "a string or an instance of " PHP_DRIVER_NAMESPACE "\\Statement");
   }
 
-  consistency = self->default_consistency;
-  page_size = self->default_page_size;
-
-  if (options) {
-    if (Z_TYPE_P(options) != IS_ARRAY &&
-        (Z_TYPE_P(options) != IS_OBJECT || !instanceof_function(Z_OBJCE_P(options), php_driver_execution_options_ce TSRMLS_CC))) {
-      INVALID_ARGUMENT(options, "an instance of " PHP_DRIVER_NAMESPACE "\\ExecutionOptions or an array or null");
-    }
-
-    if (Z_TYPE_P(options) == IS_OBJECT) {
-      opts = PHP_DRIVER_GET_EXECUTION_OPTIONS(options);
-    } else {
-      if (php_driver_execution_options_build_local_from_array(&local_opts, options TSRMLS_CC) == FAILURE) {
-        return;
-      }
-      opts = &local_opts;
-    }
-
-    if (!PHP5TO7_ZVAL_IS_UNDEF(opts->arguments))
-      arguments = PHP5TO7_Z_ARRVAL_MAYBE_P(opts->arguments);
-
-    if (opts->consistency >= 0)
-      consistency = (CassConsistency) opts->consistency;
-
-    if (opts->page_size >= 0)
-      page_size = opts->page_size;
-
-    if (opts->paging_state_token) {
-      paging_state_token = opts->paging_state_token;
-      paging_state_token_size = opts->paging_state_token_size;
-    }
-
-    if (opts->serial_consistency >= 0)
-      serial_consistency = opts->serial_consistency;
-
-    if (!PHP5TO7_ZVAL_IS_UNDEF(opts->retry_policy))
-      retry_policy = (PHP_DRIVER_GET_RETRY_POLICY(PHP5TO7_ZVAL_MAYBE_P(opts->retry_policy)))->policy;
-
-    timestamp = opts->timestamp;
-  }
+  if (get_execution_options(self, options, &opts TSRMLS_CC) == FAILURE)
+    return;
 
   object_init_ex(return_value, php_driver_future_rows_ce);
   future_rows = PHP_DRIVER_GET_FUTURE_ROWS(return_value);
+  future_rows->options.native_types = self->default_native_types;
+  future_rows->deadline = opts.deadline;
+  if (opts.result_options)
+    php_driver_result_options_merge(&future_rows->options, opts.result_options);
 
   switch (stmt->type) {
     case PHP_DRIVER_SIMPLE_STATEMENT:
     case PHP_DRIVER_PREPARED_STATEMENT:
-      single = create_single(stmt, arguments, consistency,
-                             serial_consistency, page_size,
-                             paging_state_token, paging_state_token_size,
-                             retry_policy, timestamp TSRMLS_CC);
+    case PHP_DRIVER_BOUND_STATEMENT:
+      single = create_single(self, stmt, opts.arguments, &opts TSRMLS_CC);
 
       if (!single)
         return;
 
-      future_rows->statement = php_driver_new_ref(single, free_statement);
-      future_rows->future    = cass_session_execute((CassSession *) self->session->data, single);
+      future_rows->statement = single;
+      future_rows->future    = cass_session_execute((CassSession *) self->session->data,
+                                                    (CassStatement *) single->data);
       future_rows->session   = php_driver_add_ref(self->session);
+
+      if (self->prepared_cache && statement_keyspace(stmt, &keyspace, &keyspace_len)) {
+        future_rows->prepared_cache = php_driver_add_ref(self->prepared_cache);
+        future_rows->keyspace       = estrndup(keyspace, keyspace_len);
+      }
       break;
     case PHP_DRIVER_BATCH_STATEMENT:
-      batch = create_batch(stmt, consistency, retry_policy, timestamp TSRMLS_CC);
+      batch = create_batch(stmt, opts.consistency, opts.retry_policy, opts.timestamp,
+                           opts.profile, opts.profile_size, opts.request_timeout TSRMLS_CC);
 
       if (!batch)
         return;
@@ -813,12 +654,322 @@ PHP_METHOD(DefaultSession, executeAsync)
     default:
       INVALID_ARGUMENT(statement,
         "an instance of " PHP_DRIVER_NAMESPACE "\\SimpleStatement, " \
-        PHP_DRIVER_NAMESPACE "\\PreparedStatement or " PHP_DRIVER_NAMESPACE "\\BatchStatement"
+        PHP_DRIVER_NAMESPACE "\\PreparedStatement, " PHP_DRIVER_NAMESPACE "\\BoundStatement or " \
+        PHP_DRIVER_NAMESPACE "\\BatchStatement"
       );
       return;
   }
 }
 
+/* An execution of DefaultSession::executeMany() waiting for its result */
+typedef struct {
+  CassFuture *future;
+  php_driver_ref *statement;
+  zval key;
+} pending_execution;
+
+/* Iterates over the argument rows of DefaultSession::executeMany(), an array
+ * or a Traversable */
+typedef struct {
+  HashTable *array;
+  HashPosition position;
+  zend_object_iterator *iterator;
+} argument_rows;
+
+static int
+argument_rows_init(argument_rows *rows, zval *value TSRMLS_DC)
+{
+  rows->array    = NULL;
+  rows->iterator = NULL;
+
+  if (Z_TYPE_P(value) == IS_ARRAY) {
+    rows->array = Z_ARRVAL_P(value);
+    zend_hash_internal_pointer_reset_ex(rows->array, &rows->position);
+    return SUCCESS;
+  }
+
+  if (Z_TYPE_P(value) != IS_OBJECT ||
+      !instanceof_function(Z_OBJCE_P(value), zend_ce_traversable TSRMLS_CC)) {
+    INVALID_ARGUMENT_VALUE(value, "an array or an instance of Traversable", FAILURE);
+  }
+
+  rows->iterator = Z_OBJCE_P(value)->get_iterator(Z_OBJCE_P(value), value, 0 TSRMLS_CC);
+  if (!rows->iterator || EG(exception))
+    return FAILURE;
+
+  rows->iterator->index = 0;
+  if (rows->iterator->funcs->rewind)
+    rows->iterator->funcs->rewind(rows->iterator TSRMLS_CC);
+
+  return EG(exception) ? FAILURE : SUCCESS;
+}
+
+/* Copies the current row and its key then moves to the next one, fails at
+ * the end of the rows or when the iterator throws */
+static int
+argument_rows_next(argument_rows *rows, zval *row, zval *key TSRMLS_DC)
+{
+  zend_object_iterator *iterator = rows->iterator;
+  zval *current;
+
+  if (rows->array) {
+    current = zend_hash_get_current_data_ex(rows->array, &rows->position);
+    if (!current)
+      return FAILURE;
+
+    ZVAL_DEREF(current);
+    ZVAL_COPY(row, current);
+    zend_hash_get_current_key_zval_ex(rows->array, key, &rows->position);
+    zend_hash_move_forward_ex(rows->array, &rows->position);
+    return SUCCESS;
+  }
+
+  if (iterator->funcs->valid(iterator TSRMLS_CC) != SUCCESS || EG(exception))
+    return FAILURE;
+
+  current = iterator->funcs->get_current_data(iterator TSRMLS_CC);
+  if (!current || EG(exception))
+    return FAILURE;
+  ZVAL_DEREF(current);
+  ZVAL_COPY(row, current);
+
+  if (iterator->funcs->get_current_key) {
+    iterator->funcs->get_current_key(iterator, key TSRMLS_CC);
+  } else {
+    ZVAL_LONG(key, iterator->index);
+  }
+
+  iterator->funcs->move_forward(iterator TSRMLS_CC);
+  iterator->index++;
+
+  if (EG(exception)) {
+    zval_ptr_dtor(row);
+    zval_ptr_dtor(key);
+    return FAILURE;
+  }
+
+  return SUCCESS;
+}
+
+static void
+argument_rows_destroy(argument_rows *rows TSRMLS_DC)
+{
+  if (rows->iterator)
+    zend_iterator_dtor(rows->iterator TSRMLS_CC);
+}
+
+/* Hands the result of an execution, rows or the exception it failed with, to
+ * the callback or stores it in the results, fails when the callback throws */
+static int
+report_result(execution_options *options, zval *results,
+              zval *key, zval *value TSRMLS_DC)
+{
+  int rc = SUCCESS;
+
+  if (options->callback) {
+    zval params[2];
+    zval retval;
+
+    ZVAL_COPY_VALUE(&params[0], value);
+    ZVAL_COPY_VALUE(&params[1], key);
+    ZVAL_UNDEF(&retval);
+
+    if (call_user_function(NULL, NULL, options->callback, &retval, 2, params) == FAILURE ||
+        EG(exception))
+      rc = FAILURE;
+
+    zval_ptr_dtor(&retval);
+  } else {
+    array_set_zval_key(Z_ARRVAL_P(results), key, value);
+  }
+
+  zval_ptr_dtor(value);
+  return rc;
+}
+
+/* Turns the exception thrown by an execution into its result, so that it
+ * doesn't stop the other executions */
+static void
+catch_exception(zval *value TSRMLS_DC)
+{
+  if (!EG(exception))
+    return;
+
+  zval_ptr_dtor(value);
+  ZVAL_OBJ(value, EG(exception));
+  Z_ADDREF_P(value);
+  zend_clear_exception(TSRMLS_C);
+}
+
+static int
+complete_execution(php_driver_session *self, php_driver_statement *statement,
+                   pending_execution *execution, execution_options *options,
+                   zval *results TSRMLS_DC)
+{
+  zval value;
+  int rc;
+  const CassResult *result = get_result(execution->future, options->timeout,
+                                        options->deadline TSRMLS_CC);
+
+  ZVAL_NULL(&value);
+  if (result) {
+    follow_keyspace(self, statement);
+    create_rows(self, result, execution->statement, options->result_options,
+                options->deadline, &value TSRMLS_CC);
+  }
+  catch_exception(&value TSRMLS_CC);
+
+  php_driver_future_release(execution->future, execution->statement TSRMLS_CC);
+  php_driver_del_ref(&execution->statement);
+
+  rc = report_result(options, results, &execution->key, &value TSRMLS_CC);
+  zval_ptr_dtor(&execution->key);
+
+  return rc;
+}
+
+/* Waits for the oldest execution, then completes it along with every other
+ * execution that is done, the remaining ones are kept in order */
+static int
+complete_executions(php_driver_session *self, php_driver_statement *statement,
+                    pending_execution *pending, size_t *count,
+                    execution_options *options, zval *results TSRMLS_DC)
+{
+  size_t i;
+  size_t remaining = 0;
+  int rc = SUCCESS;
+
+  for (i = 0; i < *count; i++) {
+    if (rc == SUCCESS && (i == 0 || cass_future_ready(pending[i].future))) {
+      rc = complete_execution(self, statement, &pending[i], options, results TSRMLS_CC);
+    } else {
+      pending[remaining++] = pending[i];
+    }
+  }
+
+  *count = remaining;
+  return rc;
+}
+
+PHP_METHOD(DefaultSession, executeMany)
+{
+  zval *statement = NULL;
+  zval *rows = NULL;
+  zval *options = NULL;
+  php_driver_session *self = NULL;
+  php_driver_statement *stmt = NULL;
+  php_driver_statement simple_statement;
+  execution_options opts;
+  argument_rows arguments;
+  pending_execution *pending = NULL;
+  size_t count = 0;
+  int rc = SUCCESS;
+
+  if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "zz|z", &statement, &rows, &options) == FAILURE) {
+    return;
+  }
+
+  self = PHP_DRIVER_GET_SESSION(getThis());
+
+  if (Z_TYPE_P(statement) == IS_STRING) {
+    simple_statement.type = PHP_DRIVER_SIMPLE_STATEMENT;
+    simple_statement.data.simple.cql = Z_STRVAL_P(statement);
+    stmt = &simple_statement;
+  } else if (Z_TYPE_P(statement) == IS_OBJECT &&
+             instanceof_function(Z_OBJCE_P(statement), php_driver_statement_ce TSRMLS_CC) &&
+             !instanceof_function(Z_OBJCE_P(statement), php_driver_batch_statement_ce TSRMLS_CC)) {
+    stmt = PHP_DRIVER_GET_STATEMENT(statement);
+  } else {
+    INVALID_ARGUMENT(statement, "a string or an instance of " PHP_DRIVER_NAMESPACE "\\SimpleStatement, " \
+                     PHP_DRIVER_NAMESPACE "\\PreparedStatement or " PHP_DRIVER_NAMESPACE "\\BoundStatement");
+  }
+
+  if (get_execution_options(self, options, &opts TSRMLS_CC) == FAILURE ||
+      argument_rows_init(&arguments, rows TSRMLS_CC) == FAILURE)
+    return;
+
+  if (!opts.callback)
+    array_init(return_value);
+
+  pending = (pending_execution *) ecalloc(opts.concurrency, sizeof(pending_execution));
+
+  while (rc == SUCCESS) {
+    pending_execution *execution = &pending[count];
+    zval row;
+    zval value;
+
+    if (count == (size_t) opts.concurrency) {
+      rc = complete_executions(self, stmt, pending, &count, &opts, return_value TSRMLS_CC);
+      continue;
+    }
+
+    if (argument_rows_next(&arguments, &row, &execution->key TSRMLS_CC) == FAILURE) {
+      /* The exception of the rows isn't the result of an execution */
+      if (EG(exception))
+        rc = FAILURE;
+      break;
+    }
+
+    if (Z_TYPE(row) == IS_ARRAY) {
+      execution->statement = create_single(self, stmt, Z_ARRVAL(row), &opts TSRMLS_CC);
+    } else {
+      throw_invalid_argument(&row, "row", "an array of arguments");
+      execution->statement = NULL;
+    }
+    zval_ptr_dtor(&row);
+
+    if (!execution->statement) {
+      ZVAL_NULL(&value);
+      catch_exception(&value TSRMLS_CC);
+      rc = report_result(&opts, return_value, &execution->key, &value TSRMLS_CC);
+      zval_ptr_dtor(&execution->key);
+      continue;
+    }
+
+    /* Keep the results in the order of the rows */
+    if (!opts.callback) {
+      ZVAL_NULL(&value);
+      array_set_zval_key(Z_ARRVAL_P(return_value), &execution->key, &value);
+    }
+
+    execution->future = cass_session_execute((CassSession *) self->session->data,
+                                             (CassStatement *) execution->statement->data);
+    count++;
+  }
+
+  while (rc == SUCCESS && count > 0)
+    rc = complete_executions(self, stmt, pending, &count, &opts, return_value TSRMLS_CC);
+
+  /* Left behind when the callback or the rows threw */
+  while (count > 0) {
+    pending_execution *execution = &pending[--count];
+
+    php_driver_future_release(execution->future, execution->statement TSRMLS_CC);
+    php_driver_del_ref(&execution->statement);
+    zval_ptr_dtor(&execution->key);
+  }
+
+  efree(pending);
+  argument_rows_destroy(&arguments TSRMLS_CC);
+}
+
+static void
+init_prepared_statement(zval *return_value, const CassPrepared *prepared, zval *cql)
+{
+  php_driver_statement *prepared_statement;
+  const char *keyspace;
+  size_t keyspace_len;
+
+  object_init_ex(return_value, php_driver_prepared_statement_ce);
+  prepared_statement = PHP_DRIVER_GET_STATEMENT(return_value);
+  prepared_statement->data.prepared.prepared = prepared;
+  php_driver_bind_plan_init(prepared_statement);
+
+  if (php_driver_prepared_cache_parse_use(Z_STRVAL_P(cql), Z_STRLEN_P(cql),
+                                          &keyspace, &keyspace_len))
+    prepared_statement->data.prepared.keyspace = estrndup(keyspace, keyspace_len);
+}
+
 PHP_METHOD(DefaultSession, prepare)
 {
   zval *cql = NULL;
@@ -828,7 +979,8 @@ PHP_METHOD(DefaultSession, prepare)
   php_driver_execution_options local_opts;
   CassFuture *future = NULL;
   zval *timeout = NULL;
-  php_driver_statement *prepared_statement = NULL;
+  zend_string *key = NULL;
+  const CassPrepared *prepared;
 
   if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z|z", &cql, &options) == FAILURE) {
     return;
@@ -853,17 +1005,34 @@ PHP_METHOD(DefaultSession, prepare)
     timeout = PHP5TO7_ZVAL_MAYBE_P(opts->timeout);
   }
 
+  if (self->prepared_cache) {
+    key = php_driver_prepared_cache_key(self->prepared_cache,
+                                        Z_STRVAL_P(cql), Z_STRLEN_P(cql));
+    prepared = php_driver_prepared_cache_find(self->prepared_cache, key);
+    if (prepared) {
+      init_prepared_statement(return_value, prepared, cql);
+      zend_string_release(key);
+      return;
+    }
+  }
+
   future = cass_session_prepare_n((CassSession *)self->session->data,
                                   Z_STRVAL_P(cql), Z_STRLEN_P(cql));
 
   if (php_driver_future_wait_timed(future, timeout TSRMLS_CC) == SUCCESS &&
       php_driver_future_is_error(future TSRMLS_CC) == SUCCESS) {
-    object_init_ex(return_value, php_driver_prepared_statement_ce);
-    prepared_statement = PHP_DRIVER_GET_STATEMENT(return_value);
-    prepared_statement->data.prepared.prepared = cass_future_get_prepared(future);
+    init_prepared_statement(return_value, cass_future_get_prepared(future), cql);
+
+    if (key) {
+      php_driver_prepared_cache_add(self->prepared_cache, key, future);
+      future = NULL;
+    }
   }
 
-  cass_future_free(future);
+  if (future)
+    cass_future_free(future);
+  if (key)
+    zend_string_release(key);
 }
 
 PHP_METHOD(DefaultSession, prepareAsync)
@@ -871,8 +1040,11 @@ PHP_METHOD(DefaultSession, prepareAsync)
   zval *cql = NULL;
   zval *options = NULL;
   php_driver_session *self = NULL;
-  CassFuture *future = NULL;
   php_driver_future_prepared_statement *future_prepared = NULL;
+  zend_string *key = NULL;
+  const CassPrepared *prepared;
+  const char *keyspace;
+  size_t keyspace_len;
 
   if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z|z", &cql, &options) == FAILURE) {
     return;
@@ -880,13 +1052,31 @@ PHP_METHOD(DefaultSession, prepareAsync)
 
   self = PHP_DRIVER_GET_SESSION(getThis());
 
-  future = cass_session_prepare_n((CassSession *)self->session->data,
-                                  Z_STRVAL_P(cql), Z_STRLEN_P(cql));
-
   object_init_ex(return_value, php_driver_future_prepared_statement_ce);
   future_prepared = PHP_DRIVER_GET_FUTURE_PREPARED_STATEMENT(return_value);
 
-  future_prepared->future = future;
+  if (self->prepared_cache) {
+    key = php_driver_prepared_cache_key(self->prepared_cache,
+                                        Z_STRVAL_P(cql), Z_STRLEN_P(cql));
+    prepared = php_driver_prepared_cache_find(self->prepared_cache, key);
+    if (prepared) {
+      init_prepared_statement(PHP5TO7_ZVAL_MAYBE_P(future_prepared->prepared_statement),
+                              prepared, cql);
+      zend_string_release(key);
+      return;
+    }
+
+    /* Cached once the future resolves */
+    future_prepared->prepared_cache = php_driver_add_ref(self->prepared_cache);
+    future_prepared->prepared_key   = key;
+  }
+
+  future_prepared->future = cass_session_prepare_n((CassSession *)self->session->data,
+                                                   Z_STRVAL_P(cql), Z_STRLEN_P(cql));
+
+  if (php_driver_prepared_cache_parse_use(Z_STRVAL_P(cql), Z_STRLEN_P(cql),
+                                          &keyspace, &keyspace_len))
+    future_prepared->keyspace = estrndup(keyspace, keyspace_len);
 }
 
 PHP_METHOD(DefaultSession, close)
@@ -1049,6 +1239,12 @@ ZEND_BEGIN_ARG_INFO_EX(arginfo_execute, 0, ZEND_RETURN_VALUE, 1)
   ZEND_ARG_INFO(0, options)
 ZEND_END_ARG_INFO()
 
+ZEND_BEGIN_ARG_INFO_EX(arginfo_execute_many, 0, ZEND_RETURN_VALUE, 2)
+  ZEND_ARG_INFO(0, statement)
+  ZEND_ARG_INFO(0, rows)
+  ZEND_ARG_INFO(0, options)
+ZEND_END_ARG_INFO()
+
 ZEND_BEGIN_ARG_INFO_EX(arginfo_prepare, 0, ZEND_RETURN_VALUE, 1)
   ZEND_ARG_INFO(0, cql)
   ZEND_ARG_INFO(0, options)
@@ -1064,6 +1260,7 @@ ZEND_END_ARG_INFO()
 static zend_function_entry php_driver_default_session_methods[] = {
   PHP_ME(DefaultSession, execute, arginfo_execute, ZEND_ACC_PUBLIC)
   PHP_ME(DefaultSession, executeAsync, arginfo_execute, ZEND_ACC_PUBLIC)
+  PHP_ME(DefaultSession, executeMany, arginfo_execute_many, ZEND_ACC_PUBLIC)
   PHP_ME(DefaultSession, prepare, arginfo_prepare, ZEND_ACC_PUBLIC)
   PHP_ME(DefaultSession, prepareAsync, arginfo_prepare, ZEND_ACC_PUBLIC)
   PHP_ME(DefaultSession, close, arginfo_timeout, ZEND_ACC_PUBLIC)
@@ -1122,6 +1319,7 @@ php_driver_default_session_free(php5to7_zend_object_free *object TSRMLS_DC)
   php_driver_session *self = PHP5TO7_ZEND_OBJECT_GET(session, object);
 
   php_driver_del_peref(&self->session, 1);
+  php_driver_del_peref(&self->prepared_cache, 1);
   PHP5TO7_ZVAL_MAYBE_DESTROY(self->default_timeout);
 
 #if PHP_VERSION_ID >= 80000
@@ -1139,9 +1337,12 @@ php_driver_default_session_new(zend_class_entry *ce TSRMLS_DC)
       PHP5TO7_ZEND_OBJECT_ECALLOC(session, ce);
 
   self->session             = NULL;
+  self->prepared_cache      = NULL;
   self->persist             = 0;
   self->default_consistency = PHP_DRIVER_DEFAULT_CONSISTENCY;
   self->default_page_size   = 5000;
+  self->default_native_types = cass_false;
+  self->auto_prepare        = 0;
   PHP5TO7_ZVAL_UNDEF(self->default_timeout);
 
   PHP5TO7_ZEND_OBJECT_INIT_EX(session, default_session, self, ce);
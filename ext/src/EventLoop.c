@@ -0,0 +1,154 @@
+/**
+ * Copyright 2017 DataStax, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "php_driver.h"
+#include "php_driver_globals.h"
+#include "php_driver_types.h"
+#include "util/future.h"
+
+#ifndef _WIN32
+#include <errno.h>
+#include <unistd.h>
+#endif
+
+zend_class_entry *php_driver_event_loop_ce = NULL;
+
+PHP_METHOD(EventLoop, __construct)
+{
+}
+
+PHP_METHOD(EventLoop, stream)
+{
+#ifndef _WIN32
+  php_stream *stream;
+  int fd;
+
+  if (zend_parse_parameters_none() == FAILURE) {
+    return;
+  }
+
+  /* The stream owns a duplicate so that closing it leaves the pipe open */
+  fd = php_driver_future_notification_fd();
+  if (fd < 0 || (fd = dup(fd)) < 0) {
+    zend_throw_exception_ex(php_driver_runtime_exception_ce, 0 TSRMLS_CC,
+                            "Unable to create the notification pipe: %s",
+                            strerror(errno));
+    return;
+  }
+
+  stream = php_stream_fopen_from_fd(fd, "r", NULL);
+  if (!stream) {
+    close(fd);
+    zend_throw_exception_ex(php_driver_runtime_exception_ce, 0 TSRMLS_CC,
+                            "Unable to open the notification pipe");
+    return;
+  }
+
+  php_stream_to_zval(stream, return_value);
+#else
+  zend_throw_exception_ex(php_driver_runtime_exception_ce, 0 TSRMLS_CC,
+                          "Completion notifications aren't supported on Windows");
+#endif
+}
+
+PHP_METHOD(EventLoop, watch)
+{
+  zval *future;
+  CassFuture *cass_future;
+
+  if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "O",
+                            &future, php_driver_future_ce) == FAILURE) {
+    return;
+  }
+
+  if (PHP5TO7_ZVAL_IS_UNDEF(PHP_DRIVER_G(watched_futures))) {
+    array_init(PHP5TO7_ZVAL_MAYBE_P(PHP_DRIVER_G(watched_futures)));
+  }
+
+  Z_TRY_ADDREF_P(future);
+  zend_hash_index_update(PHP5TO7_Z_ARRVAL_MAYBE_P(PHP_DRIVER_G(watched_futures)),
+                         Z_OBJ_HANDLE_P(future), future);
+
+  /* Futures without a driver future are already complete */
+  cass_future = php_driver_future_get(future);
+  if (cass_future) {
+    php_driver_future_watch(cass_future);
+  } else {
+    php_driver_future_notify();
+  }
+}
+
+PHP_METHOD(EventLoop, drain)
+{
+  HashTable *watched;
+  zend_ulong handle;
+  zval *future;
+
+  if (zend_parse_parameters_none() == FAILURE) {
+    return;
+  }
+
+  /* Cleared before looking at the futures so that the ones completing
+   * afterwards signal the pipe again */
+  php_driver_future_clear_notification();
+
+  array_init(return_value);
+
+  if (PHP5TO7_ZVAL_IS_UNDEF(PHP_DRIVER_G(watched_futures)))
+    return;
+
+  watched = PHP5TO7_Z_ARRVAL_MAYBE_P(PHP_DRIVER_G(watched_futures));
+  ZEND_HASH_FOREACH_NUM_KEY_VAL(watched, handle, future) {
+    CassFuture *cass_future = php_driver_future_get(future);
+
+    if (cass_future && !cass_future_ready(cass_future))
+      continue;
+
+    Z_TRY_ADDREF_P(future);
+    add_next_index_zval(return_value, future);
+    zend_hash_index_del(watched, handle);
+  } ZEND_HASH_FOREACH_END();
+}
+
+#if PHP_VERSION_ID >= 80100
+/* Constructors cannot declare a return type; use untyped arginfo */
+ZEND_BEGIN_ARG_INFO_EX(arginfo_none, 0, 0, 0)
+ZEND_END_ARG_INFO()
+#else
+ZEND_BEGIN_ARG_INFO_EX(arginfo_none, 0, ZEND_RETURN_VALUE, 0)
+ZEND_END_ARG_INFO()
+#endif
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_future, 0, ZEND_RETURN_VALUE, 1)
+  PHP_DRIVER_NAMESPACE_ZEND_ARG_OBJ_INFO(0, future, Future, 0)
+ZEND_END_ARG_INFO()
+
+static zend_function_entry php_driver_event_loop_methods[] = {
+  PHP_ME(EventLoop, __construct, arginfo_none, ZEND_ACC_PRIVATE | ZEND_ACC_CTOR)
+  PHP_ME(EventLoop, stream, arginfo_none, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+  PHP_ME(EventLoop, watch, arginfo_future, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+  PHP_ME(EventLoop, drain, arginfo_none, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+  PHP_FE_END
+};
+
+void php_driver_define_EventLoop(TSRMLS_D)
+{
+  zend_class_entry ce;
+
+  INIT_CLASS_ENTRY(ce, PHP_DRIVER_NAMESPACE "\\EventLoop", php_driver_event_loop_methods);
+  php_driver_event_loop_ce = zend_register_internal_class(&ce TSRMLS_CC);
+  php_driver_event_loop_ce->ce_flags |= PHP5TO7_ZEND_ACC_FINAL;
+}
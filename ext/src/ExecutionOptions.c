@@ -18,6 +18,7 @@
 #include "php_driver_types.h"
 #include "util/consistency.h"
 #include "util/math.h"
+#include "util/result.h"
 
 zend_class_entry *php_driver_execution_options_ce = NULL;
 
@@ -28,36 +29,88 @@ static void init_execution_options(php_driver_execution_options *self)
   self->page_size = -1;
   self->paging_state_token = NULL;
   self->paging_state_token_size = 0;
+  self->profile = NULL;
+  self->profile_size = 0;
   self->timestamp = INT64_MIN;
+  self->concurrency = -1;
+  php_driver_result_options_init(&self->result);
   PHP5TO7_ZVAL_UNDEF(self->arguments);
   PHP5TO7_ZVAL_UNDEF(self->timeout);
+  PHP5TO7_ZVAL_UNDEF(self->deadline);
   PHP5TO7_ZVAL_UNDEF(self->retry_policy);
+  PHP5TO7_ZVAL_UNDEF(self->callback);
 }
 
+/* Options are only looked up until every entry of the array was found, so
+ * that small arrays, e.g. a profile and arguments, cost a few lookups */
+#define FIND_OPTION(name, value) \
+  (remaining > 0 && \
+   PHP5TO7_ZEND_HASH_FIND(Z_ARRVAL_P(options), name, sizeof(name), value) && \
+   (remaining--, 1))
+
 static int build_from_array(php_driver_execution_options *self, zval *options, int copy TSRMLS_DC)
 {
+  uint32_t remaining = zend_hash_num_elements(Z_ARRVAL_P(options));
+  php5to7_zval *profile = NULL;
   php5to7_zval *consistency = NULL;
   php5to7_zval *serial_consistency = NULL;
   php5to7_zval *page_size = NULL;
   php5to7_zval *paging_state_token = NULL;
   php5to7_zval *timeout = NULL;
+  php5to7_zval *deadline = NULL;
   php5to7_zval *arguments = NULL;
   php5to7_zval *retry_policy = NULL;
   php5to7_zval *timestamp = NULL;
+  php5to7_zval *concurrency = NULL;
+  php5to7_zval *callback = NULL;
+  php5to7_zval *lazy = NULL;
+  php5to7_zval *row_objects = NULL;
+  php5to7_zval *native_types = NULL;
+  php5to7_zval *fetch_style = NULL;
+  php5to7_zval *fetch_column = NULL;
+  php5to7_zval *columns = NULL;
+  php5to7_zval *columnar = NULL;
+
+  if (FIND_OPTION("profile", profile)) {
+    if (Z_TYPE_P(PHP5TO7_ZVAL_MAYBE_DEREF(profile)) != IS_STRING) {
+      throw_invalid_argument(PHP5TO7_ZVAL_MAYBE_DEREF(profile), "profile", "a string" TSRMLS_CC);
+      return FAILURE;
+    }
+    if (copy) {
+      self->profile = estrndup(Z_STRVAL_P(PHP5TO7_ZVAL_MAYBE_DEREF(profile)),
+                               Z_STRLEN_P(PHP5TO7_ZVAL_MAYBE_DEREF(profile)));
+    } else {
+      self->profile = Z_STRVAL_P(PHP5TO7_ZVAL_MAYBE_DEREF(profile));
+    }
+    self->profile_size = Z_STRLEN_P(PHP5TO7_ZVAL_MAYBE_DEREF(profile));
+  }
+
+  if (FIND_OPTION("arguments", arguments)) {
+    if (Z_TYPE_P(PHP5TO7_ZVAL_MAYBE_DEREF(arguments)) != IS_ARRAY) {
+      throw_invalid_argument(PHP5TO7_ZVAL_MAYBE_DEREF(arguments), "arguments", "an array" TSRMLS_CC);
+      return FAILURE;
+    }
 
-  if (PHP5TO7_ZEND_HASH_FIND(Z_ARRVAL_P(options), "consistency", sizeof("consistency"), consistency)) {
+    if (copy) {
+      PHP5TO7_ZVAL_COPY(PHP5TO7_ZVAL_MAYBE_P(self->arguments), PHP5TO7_ZVAL_MAYBE_DEREF(arguments));
+    } else {
+      self->arguments = *arguments;
+    }
+  }
+
+  if (FIND_OPTION("consistency", consistency)) {
     if (php_driver_get_consistency(PHP5TO7_ZVAL_MAYBE_DEREF(consistency), &self->consistency TSRMLS_CC) == FAILURE) {
       return FAILURE;
     }
   }
 
-  if (PHP5TO7_ZEND_HASH_FIND(Z_ARRVAL_P(options), "serial_consistency", sizeof("serial_consistency"), serial_consistency)) {
+  if (FIND_OPTION("serial_consistency", serial_consistency)) {
     if (php_driver_get_serial_consistency(PHP5TO7_ZVAL_MAYBE_DEREF(serial_consistency), &self->serial_consistency TSRMLS_CC) == FAILURE) {
       return FAILURE;
     }
   }
 
-  if (PHP5TO7_ZEND_HASH_FIND(Z_ARRVAL_P(options), "page_size", sizeof("page_size"), page_size)) {
+  if (FIND_OPTION("page_size", page_size)) {
     if (Z_TYPE_P(PHP5TO7_ZVAL_MAYBE_DEREF(page_size)) != IS_LONG || Z_LVAL_P(PHP5TO7_ZVAL_MAYBE_DEREF(page_size)) <= 0) {
       throw_invalid_argument(PHP5TO7_ZVAL_MAYBE_DEREF(page_size), "page_size", "greater than zero" TSRMLS_CC);
       return FAILURE;
@@ -65,7 +118,7 @@ static int build_from_array(php_driver_execution_options *self, zval *options, i
     self->page_size = Z_LVAL_P(PHP5TO7_ZVAL_MAYBE_DEREF(page_size));
   }
 
-  if (PHP5TO7_ZEND_HASH_FIND(Z_ARRVAL_P(options), "paging_state_token", sizeof("paging_state_token"), paging_state_token)) {
+  if (FIND_OPTION("paging_state_token", paging_state_token)) {
     if (Z_TYPE_P(PHP5TO7_ZVAL_MAYBE_DEREF(paging_state_token)) != IS_STRING) {
       throw_invalid_argument(PHP5TO7_ZVAL_MAYBE_DEREF(paging_state_token), "paging_state_token", "a string" TSRMLS_CC);
       return FAILURE;
@@ -79,7 +132,7 @@ static int build_from_array(php_driver_execution_options *self, zval *options, i
     self->paging_state_token_size = Z_STRLEN_P(PHP5TO7_ZVAL_MAYBE_DEREF(paging_state_token));
   }
 
-  if (PHP5TO7_ZEND_HASH_FIND(Z_ARRVAL_P(options), "timeout", sizeof("timeout"), timeout)) {
+  if (FIND_OPTION("timeout", timeout)) {
     if (!(Z_TYPE_P(PHP5TO7_ZVAL_MAYBE_DEREF(timeout)) == IS_LONG   && Z_LVAL_P(PHP5TO7_ZVAL_MAYBE_DEREF(timeout)) > 0) &&
         !(Z_TYPE_P(PHP5TO7_ZVAL_MAYBE_DEREF(timeout)) == IS_DOUBLE && Z_DVAL_P(PHP5TO7_ZVAL_MAYBE_DEREF(timeout)) > 0) &&
         !(Z_TYPE_P(PHP5TO7_ZVAL_MAYBE_DEREF(timeout)) == IS_NULL)) {
@@ -94,20 +147,22 @@ static int build_from_array(php_driver_execution_options *self, zval *options, i
     }
   }
 
-  if (PHP5TO7_ZEND_HASH_FIND(Z_ARRVAL_P(options), "arguments", sizeof("arguments"), arguments)) {
-    if (Z_TYPE_P(PHP5TO7_ZVAL_MAYBE_DEREF(arguments)) != IS_ARRAY) {
-      throw_invalid_argument(PHP5TO7_ZVAL_MAYBE_DEREF(arguments), "arguments", "an array" TSRMLS_CC);
+  if (FIND_OPTION("deadline", deadline)) {
+    if (!(Z_TYPE_P(PHP5TO7_ZVAL_MAYBE_DEREF(deadline)) == IS_LONG   && Z_LVAL_P(PHP5TO7_ZVAL_MAYBE_DEREF(deadline)) > 0) &&
+        !(Z_TYPE_P(PHP5TO7_ZVAL_MAYBE_DEREF(deadline)) == IS_DOUBLE && Z_DVAL_P(PHP5TO7_ZVAL_MAYBE_DEREF(deadline)) > 0) &&
+        !(Z_TYPE_P(PHP5TO7_ZVAL_MAYBE_DEREF(deadline)) == IS_NULL)) {
+      throw_invalid_argument(PHP5TO7_ZVAL_MAYBE_DEREF(deadline), "deadline", "a number of seconds greater than zero or null" TSRMLS_CC);
       return FAILURE;
     }
 
     if (copy) {
-      PHP5TO7_ZVAL_COPY(PHP5TO7_ZVAL_MAYBE_P(self->arguments), PHP5TO7_ZVAL_MAYBE_DEREF(arguments));
+      PHP5TO7_ZVAL_COPY(PHP5TO7_ZVAL_MAYBE_P(self->deadline), PHP5TO7_ZVAL_MAYBE_DEREF(deadline));
     } else {
-      self->arguments = *arguments;
+      self->deadline = *deadline;
     }
   }
 
-  if (PHP5TO7_ZEND_HASH_FIND(Z_ARRVAL_P(options), "retry_policy", sizeof("retry_policy"), retry_policy)) {
+  if (FIND_OPTION("retry_policy", retry_policy)) {
     if (Z_TYPE_P(PHP5TO7_ZVAL_MAYBE_DEREF(retry_policy)) != IS_OBJECT &&
         !instanceof_function(Z_OBJCE_P(PHP5TO7_ZVAL_MAYBE_DEREF(retry_policy)),
                              php_driver_retry_policy_ce TSRMLS_CC)) {
@@ -124,7 +179,7 @@ static int build_from_array(php_driver_execution_options *self, zval *options, i
     }
   }
 
-  if (PHP5TO7_ZEND_HASH_FIND(Z_ARRVAL_P(options), "timestamp", sizeof("timestamp"), timestamp)) {
+  if (FIND_OPTION("timestamp", timestamp)) {
     if (Z_TYPE_P(PHP5TO7_ZVAL_MAYBE_DEREF(timestamp)) == IS_LONG) {
       self->timestamp = Z_LVAL_P(PHP5TO7_ZVAL_MAYBE_DEREF(timestamp));
     } else if (Z_TYPE_P(PHP5TO7_ZVAL_MAYBE_DEREF(timestamp)) == IS_STRING) {
@@ -138,6 +193,102 @@ static int build_from_array(php_driver_execution_options *self, zval *options, i
       return FAILURE;
     }
   }
+
+  if (FIND_OPTION("concurrency", concurrency)) {
+    if (Z_TYPE_P(PHP5TO7_ZVAL_MAYBE_DEREF(concurrency)) != IS_LONG || Z_LVAL_P(PHP5TO7_ZVAL_MAYBE_DEREF(concurrency)) <= 0) {
+      throw_invalid_argument(PHP5TO7_ZVAL_MAYBE_DEREF(concurrency), "concurrency", "greater than zero" TSRMLS_CC);
+      return FAILURE;
+    }
+    self->concurrency = Z_LVAL_P(PHP5TO7_ZVAL_MAYBE_DEREF(concurrency));
+  }
+
+  if (FIND_OPTION("callback", callback)) {
+    if (!zend_is_callable(PHP5TO7_ZVAL_MAYBE_DEREF(callback), 0, NULL TSRMLS_CC)) {
+      throw_invalid_argument(PHP5TO7_ZVAL_MAYBE_DEREF(callback), "callback", "a callable" TSRMLS_CC);
+      return FAILURE;
+    }
+
+    if (copy) {
+      PHP5TO7_ZVAL_COPY(PHP5TO7_ZVAL_MAYBE_P(self->callback), PHP5TO7_ZVAL_MAYBE_DEREF(callback));
+    } else {
+      self->callback = *callback;
+    }
+  }
+
+  if (FIND_OPTION("lazy", lazy)) {
+    if (!PHP5TO7_ZVAL_IS_BOOL_P(PHP5TO7_ZVAL_MAYBE_DEREF(lazy))) {
+      throw_invalid_argument(PHP5TO7_ZVAL_MAYBE_DEREF(lazy), "lazy", "a boolean" TSRMLS_CC);
+      return FAILURE;
+    }
+    self->result.lazy = PHP5TO7_ZVAL_IS_TRUE_P(PHP5TO7_ZVAL_MAYBE_DEREF(lazy));
+  }
+
+  if (FIND_OPTION("row_objects", row_objects)) {
+    if (!PHP5TO7_ZVAL_IS_BOOL_P(PHP5TO7_ZVAL_MAYBE_DEREF(row_objects))) {
+      throw_invalid_argument(PHP5TO7_ZVAL_MAYBE_DEREF(row_objects), "row_objects", "a boolean" TSRMLS_CC);
+      return FAILURE;
+    }
+    self->result.row_objects = PHP5TO7_ZVAL_IS_TRUE_P(PHP5TO7_ZVAL_MAYBE_DEREF(row_objects));
+  }
+
+  if (FIND_OPTION("native_types", native_types)) {
+    if (!PHP5TO7_ZVAL_IS_BOOL_P(PHP5TO7_ZVAL_MAYBE_DEREF(native_types))) {
+      throw_invalid_argument(PHP5TO7_ZVAL_MAYBE_DEREF(native_types), "native_types", "a boolean" TSRMLS_CC);
+      return FAILURE;
+    }
+    self->result.native_types = PHP5TO7_ZVAL_IS_TRUE_P(PHP5TO7_ZVAL_MAYBE_DEREF(native_types));
+  }
+
+  if (FIND_OPTION("columnar", columnar)) {
+    if (!PHP5TO7_ZVAL_IS_BOOL_P(PHP5TO7_ZVAL_MAYBE_DEREF(columnar))) {
+      throw_invalid_argument(PHP5TO7_ZVAL_MAYBE_DEREF(columnar), "columnar", "a boolean" TSRMLS_CC);
+      return FAILURE;
+    }
+    self->result.columnar = PHP5TO7_ZVAL_IS_TRUE_P(PHP5TO7_ZVAL_MAYBE_DEREF(columnar));
+  }
+
+  if (FIND_OPTION("fetch_style", fetch_style)) {
+    if (Z_TYPE_P(PHP5TO7_ZVAL_MAYBE_DEREF(fetch_style)) != IS_LONG ||
+        Z_LVAL_P(PHP5TO7_ZVAL_MAYBE_DEREF(fetch_style)) < PHP_DRIVER_FETCH_ASSOC ||
+        Z_LVAL_P(PHP5TO7_ZVAL_MAYBE_DEREF(fetch_style)) > PHP_DRIVER_FETCH_GROUP) {
+      throw_invalid_argument(PHP5TO7_ZVAL_MAYBE_DEREF(fetch_style), "fetch_style",
+                             "one of " PHP_DRIVER_NAMESPACE "::FETCH_*" TSRMLS_CC);
+      return FAILURE;
+    }
+    self->result.fetch_style = Z_LVAL_P(PHP5TO7_ZVAL_MAYBE_DEREF(fetch_style));
+  }
+
+  if (FIND_OPTION("fetch_column", fetch_column)) {
+    if (Z_TYPE_P(PHP5TO7_ZVAL_MAYBE_DEREF(fetch_column)) != IS_LONG ||
+        Z_LVAL_P(PHP5TO7_ZVAL_MAYBE_DEREF(fetch_column)) < 0) {
+      throw_invalid_argument(PHP5TO7_ZVAL_MAYBE_DEREF(fetch_column), "fetch_column",
+                             "a positive integer" TSRMLS_CC);
+      return FAILURE;
+    }
+    self->result.fetch_column = Z_LVAL_P(PHP5TO7_ZVAL_MAYBE_DEREF(fetch_column));
+  }
+
+  if (FIND_OPTION("columns", columns)) {
+    php5to7_zval *column;
+
+    if (Z_TYPE_P(PHP5TO7_ZVAL_MAYBE_DEREF(columns)) != IS_ARRAY) {
+      throw_invalid_argument(PHP5TO7_ZVAL_MAYBE_DEREF(columns), "columns", "an array of column names" TSRMLS_CC);
+      return FAILURE;
+    }
+
+    PHP5TO7_ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(PHP5TO7_ZVAL_MAYBE_DEREF(columns)), column) {
+      if (Z_TYPE_P(PHP5TO7_ZVAL_MAYBE_DEREF(column)) != IS_STRING) {
+        throw_invalid_argument(PHP5TO7_ZVAL_MAYBE_DEREF(columns), "columns", "an array of column names" TSRMLS_CC);
+        return FAILURE;
+      }
+    } PHP5TO7_ZEND_HASH_FOREACH_END(Z_ARRVAL_P(PHP5TO7_ZVAL_MAYBE_DEREF(columns)));
+
+    if (copy) {
+      PHP5TO7_ZVAL_COPY(PHP5TO7_ZVAL_MAYBE_P(self->result.columns), PHP5TO7_ZVAL_MAYBE_DEREF(columns));
+    } else {
+      self->result.columns = *columns;
+    }
+  }
   return SUCCESS;
 }
 
@@ -206,6 +357,11 @@ PHP_METHOD(ExecutionOptions, __get)
       RETURN_NULL();
     }
     RETURN_ZVAL(PHP5TO7_ZVAL_MAYBE_P(self->timeout), 1, 0);
+  } else if (name_len == 8 && strncmp("deadline", name, name_len) == 0) {
+    if (PHP5TO7_ZVAL_IS_UNDEF(self->deadline)) {
+      RETURN_NULL();
+    }
+    RETURN_ZVAL(PHP5TO7_ZVAL_MAYBE_P(self->deadline), 1, 0);
   } else if (name_len == 9 && strncmp("arguments", name, name_len) == 0) {
     if (PHP5TO7_ZVAL_IS_UNDEF(self->arguments)) {
       RETURN_NULL();
@@ -228,6 +384,56 @@ PHP_METHOD(ExecutionOptions, __get)
 #endif
     PHP5TO7_RETVAL_STRING(string);
     efree(string);
+  } else if (name_len == 11 && strncmp("concurrency", name, name_len) == 0) {
+    if (self->concurrency == -1) {
+      RETURN_NULL();
+    }
+    RETURN_LONG(self->concurrency);
+  } else if (name_len == 8 && strncmp("callback", name, name_len) == 0) {
+    if (PHP5TO7_ZVAL_IS_UNDEF(self->callback)) {
+      RETURN_NULL();
+    }
+    RETURN_ZVAL(PHP5TO7_ZVAL_MAYBE_P(self->callback), 1, 0);
+  } else if (name_len == 4 && strncmp("lazy", name, name_len) == 0) {
+    if (self->result.lazy == -1) {
+      RETURN_NULL();
+    }
+    RETURN_BOOL(self->result.lazy);
+  } else if (name_len == 10 && strncmp("rowObjects", name, name_len) == 0) {
+    if (self->result.row_objects == -1) {
+      RETURN_NULL();
+    }
+    RETURN_BOOL(self->result.row_objects);
+  } else if (name_len == 11 && strncmp("nativeTypes", name, name_len) == 0) {
+    if (self->result.native_types == -1) {
+      RETURN_NULL();
+    }
+    RETURN_BOOL(self->result.native_types);
+  } else if (name_len == 8 && strncmp("columnar", name, name_len) == 0) {
+    if (self->result.columnar == -1) {
+      RETURN_NULL();
+    }
+    RETURN_BOOL(self->result.columnar);
+  } else if (name_len == 10 && strncmp("fetchStyle", name, name_len) == 0) {
+    if (self->result.fetch_style == -1) {
+      RETURN_NULL();
+    }
+    RETURN_LONG(self->result.fetch_style);
+  } else if (name_len == 11 && strncmp("fetchColumn", name, name_len) == 0) {
+    if (self->result.fetch_style != PHP_DRIVER_FETCH_COLUMN) {
+      RETURN_NULL();
+    }
+    RETURN_LONG(self->result.fetch_column);
+  } else if (name_len == 7 && strncmp("columns", name, name_len) == 0) {
+    if (PHP5TO7_ZVAL_IS_UNDEF(self->result.columns)) {
+      RETURN_NULL();
+    }
+    RETURN_ZVAL(PHP5TO7_ZVAL_MAYBE_P(self->result.columns), 1, 0);
+  } else if (name_len == 7 && strncmp("profile", name, name_len) == 0) {
+    if (!self->profile) {
+      RETURN_NULL();
+    }
+    PHP5TO7_RETURN_STRINGL(self->profile, self->profile_size);
   }
 }
 
@@ -279,9 +485,15 @@ php_driver_execution_options_free(php5to7_zend_object_free *object TSRMLS_DC)
   if (self->paging_state_token) {
     efree(self->paging_state_token);
   }
+  if (self->profile) {
+    efree(self->profile);
+  }
   PHP5TO7_ZVAL_MAYBE_DESTROY(self->arguments);
   PHP5TO7_ZVAL_MAYBE_DESTROY(self->timeout);
+  PHP5TO7_ZVAL_MAYBE_DESTROY(self->deadline);
   PHP5TO7_ZVAL_MAYBE_DESTROY(self->retry_policy);
+  PHP5TO7_ZVAL_MAYBE_DESTROY(self->callback);
+  php_driver_result_options_destroy(&self->result);
 
 #if PHP_VERSION_ID >= 80000
   zend_object_std_dtor(&self->std);
@@ -312,6 +524,10 @@ void php_driver_define_ExecutionOptions(TSRMLS_D)
   php_driver_execution_options_ce->create_object = php_driver_execution_options_new;
 
   memcpy(&php_driver_execution_options_handlers, zend_get_std_object_handlers(), sizeof(zend_object_handlers));
+#if PHP_VERSION_ID >= 80000
+  php_driver_execution_options_handlers.offset   = XtOffsetOf(php_driver_execution_options, std);
+  php_driver_execution_options_handlers.free_obj = php_driver_execution_options_free;
+#endif
   php_driver_execution_options_handlers.get_properties = php_driver_execution_options_properties;
   /* compare_objects was removed in PHP 8 */
 #if PHP_VERSION_ID < 80000
@@ -22,8 +22,12 @@ ZEND_BEGIN_ARG_INFO_EX(arginfo_timeout, 0, ZEND_RETURN_VALUE, 0)
   ZEND_ARG_INFO(0, timeout)
 ZEND_END_ARG_INFO()
 
+ZEND_BEGIN_ARG_INFO_EX(arginfo_none, 0, ZEND_RETURN_VALUE, 0)
+ZEND_END_ARG_INFO()
+
 static zend_function_entry php_driver_future_methods[] = {
   PHP_ABSTRACT_ME(Future, get, arginfo_timeout)
+  PHP_ABSTRACT_ME(Future, cancel, arginfo_none)
   PHP_FE_END
 };
 
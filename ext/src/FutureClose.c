@@ -18,6 +18,8 @@
 #include "php_driver_types.h"
 #include "util/future.h"
 
+#include "Scheduler.h"
+
 zend_class_entry *php_driver_future_close_ce = NULL;
 
 PHP_METHOD(FutureClose, get)
@@ -37,12 +39,40 @@ PHP_METHOD(FutureClose, get)
     return;
 }
 
+PHP_METHOD(FutureClose, await)
+{
+  zval *timeout = NULL;
+
+  if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "|z", &timeout) == FAILURE) {
+    return;
+  }
+
+  if (php_driver_scheduler_await(getThis(), timeout TSRMLS_CC) == FAILURE) {
+    return;
+  }
+
+  PHP_MN(FutureClose_get)(INTERNAL_FUNCTION_PARAM_PASSTHRU);
+}
+
+PHP_METHOD(FutureClose, cancel)
+{
+  if (zend_parse_parameters_none() == FAILURE)
+    return;
+
+  RETURN_FALSE;
+}
+
 ZEND_BEGIN_ARG_INFO_EX(arginfo_timeout, 0, ZEND_RETURN_VALUE, 0)
   ZEND_ARG_INFO(0, timeout)
 ZEND_END_ARG_INFO()
 
+ZEND_BEGIN_ARG_INFO_EX(arginfo_none, 0, ZEND_RETURN_VALUE, 0)
+ZEND_END_ARG_INFO()
+
 static zend_function_entry php_driver_future_close_methods[] = {
   PHP_ME(FutureClose, get, arginfo_timeout, ZEND_ACC_PUBLIC)
+  PHP_ME(FutureClose, await, arginfo_timeout, ZEND_ACC_PUBLIC)
+  PHP_ME(FutureClose, cancel, arginfo_none, ZEND_ACC_PUBLIC)
   PHP_FE_END
 };
 
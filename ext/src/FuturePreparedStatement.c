@@ -16,7 +16,12 @@
 
 #include "php_driver.h"
 #include "php_driver_types.h"
+#include "util/bind.h"
 #include "util/future.h"
+#include "util/prepared_cache.h"
+#include "util/ref.h"
+
+#include "Scheduler.h"
 
 zend_class_entry *php_driver_future_prepared_statement_ce = NULL;
 
@@ -43,20 +48,57 @@ PHP_METHOD(FuturePreparedStatement, get)
     return;
   }
 
-  object_init_ex(return_value, php_driver_statement_ce);
+  object_init_ex(return_value, php_driver_prepared_statement_ce);
   PHP5TO7_ZVAL_COPY(PHP5TO7_ZVAL_MAYBE_P(self->prepared_statement), return_value);
 
   prepared_statement = PHP_DRIVER_GET_STATEMENT(return_value);
 
   prepared_statement->data.prepared.prepared = cass_future_get_prepared(self->future);
+  prepared_statement->data.prepared.keyspace = self->keyspace;
+  self->keyspace = NULL;
+  php_driver_bind_plan_init(prepared_statement);
+
+  /* The session's cache takes over the resolved future */
+  if (self->prepared_cache) {
+    php_driver_prepared_cache_add(self->prepared_cache, self->prepared_key, self->future);
+    self->future = NULL;
+  }
+}
+
+PHP_METHOD(FuturePreparedStatement, await)
+{
+  zval *timeout = NULL;
+
+  if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "|z", &timeout) == FAILURE) {
+    return;
+  }
+
+  if (php_driver_scheduler_await(getThis(), timeout TSRMLS_CC) == FAILURE) {
+    return;
+  }
+
+  PHP_MN(FuturePreparedStatement_get)(INTERNAL_FUNCTION_PARAM_PASSTHRU);
+}
+
+PHP_METHOD(FuturePreparedStatement, cancel)
+{
+  if (zend_parse_parameters_none() == FAILURE)
+    return;
+
+  RETURN_FALSE;
 }
 
 ZEND_BEGIN_ARG_INFO_EX(arginfo_timeout, 0, ZEND_RETURN_VALUE, 0)
   ZEND_ARG_INFO(0, timeout)
 ZEND_END_ARG_INFO()
 
+ZEND_BEGIN_ARG_INFO_EX(arginfo_none, 0, ZEND_RETURN_VALUE, 0)
+ZEND_END_ARG_INFO()
+
 static zend_function_entry php_driver_future_prepared_statement_methods[] = {
   PHP_ME(FuturePreparedStatement, get, arginfo_timeout, ZEND_ACC_PUBLIC)
+  PHP_ME(FuturePreparedStatement, await, arginfo_timeout, ZEND_ACC_PUBLIC)
+  PHP_ME(FuturePreparedStatement, cancel, arginfo_none, ZEND_ACC_PUBLIC)
   PHP_FE_END
 };
 
@@ -97,6 +139,13 @@ php_driver_future_prepared_statement_free(php5to7_zend_object_free *object TSRML
   }
 
   PHP5TO7_ZVAL_MAYBE_DESTROY(self->prepared_statement);
+  php_driver_del_peref(&self->prepared_cache, 1);
+
+  if (self->keyspace)
+    efree(self->keyspace);
+
+  if (self->prepared_key)
+    zend_string_release(self->prepared_key);
 
 #if PHP_VERSION_ID >= 80000
   zend_object_std_dtor(&self->std);
@@ -113,6 +162,9 @@ php_driver_future_prepared_statement_new(zend_class_entry *ce TSRMLS_DC)
       PHP5TO7_ZEND_OBJECT_ECALLOC(future_prepared_statement, ce);
 
   self->future = NULL;
+  self->prepared_cache = NULL;
+  self->prepared_key = NULL;
+  self->keyspace = NULL;
   PHP5TO7_ZVAL_UNDEF(self->prepared_statement);
 
   PHP5TO7_ZEND_OBJECT_INIT(future_prepared_statement, self, ce);
@@ -17,9 +17,13 @@
 #include "php_driver.h"
 #include "php_driver_types.h"
 #include "util/future.h"
+#include "util/prepared_cache.h"
 #include "util/result.h"
 #include "util/ref.h"
 
+#include "Rows.h"
+#include "Scheduler.h"
+
 zend_class_entry *php_driver_future_rows_ce = NULL;
 
 static void
@@ -28,13 +32,30 @@ free_result(void *result)
   cass_result_free((CassResult *) result);
 }
 
+/* A USE query switched the session to another keyspace */
+static void
+follow_keyspace(php_driver_future_rows *future_rows)
+{
+  php_driver_prepared_cache_use(future_rows->prepared_cache, future_rows->keyspace,
+                                strlen(future_rows->keyspace));
+  efree(future_rows->keyspace);
+  future_rows->keyspace = NULL;
+}
+
 int
 php_driver_future_rows_get_result(php_driver_future_rows *future_rows, zval *timeout TSRMLS_DC)
 {
   if (!future_rows->result) {
     const CassResult *result = NULL;
 
-    if (php_driver_future_wait_timed(future_rows->future, timeout TSRMLS_CC) == FAILURE) {
+    if (!future_rows->future) {
+      zend_throw_exception_ex(php_driver_runtime_exception_ce, 0 TSRMLS_CC,
+                              "Future was cancelled.");
+      return FAILURE;
+    }
+
+    if (php_driver_future_wait_deadline(future_rows->future, timeout,
+                                        future_rows->deadline TSRMLS_CC) == FAILURE) {
       return FAILURE;
     }
 
@@ -50,6 +71,9 @@ php_driver_future_rows_get_result(php_driver_future_rows *future_rows, zval *tim
     }
 
     future_rows->result = php_driver_new_ref((void *)result, free_result);
+
+    if (future_rows->keyspace)
+      follow_keyspace(future_rows);
   }
 
   return SUCCESS;
@@ -70,9 +94,28 @@ PHP_METHOD(FutureRows, get)
     return;
   }
 
+  if (php_driver_result_options_lazy(&self->options)) {
+    object_init_ex(return_value, php_driver_rows_ce);
+    rows = PHP_DRIVER_GET_ROWS(return_value);
+    php_driver_result_options_merge(&rows->options, &self->options);
+
+    if (php_driver_rows_init_lazy(rows, self->result TSRMLS_CC) == FAILURE) {
+      return;
+    }
+
+    if (cass_result_has_more_pages((const CassResult *)self->result->data)) {
+      rows->session   = php_driver_add_ref(self->session);
+      rows->statement = php_driver_add_ref(self->statement);
+      rows->result    = php_driver_add_ref(self->result);
+      rows->deadline  = self->deadline;
+    }
+    return;
+  }
+
   if (PHP5TO7_ZVAL_IS_UNDEF(self->rows)) {
     if (php_driver_get_result((const CassResult *) self->result->data,
-                                 &self->rows TSRMLS_CC) == FAILURE) {
+                              &self->options,
+                              &self->rows TSRMLS_CC) == FAILURE) {
       PHP5TO7_ZVAL_MAYBE_DESTROY(self->rows);
       return;
     }
@@ -80,6 +123,7 @@ PHP_METHOD(FutureRows, get)
 
   object_init_ex(return_value, php_driver_rows_ce);
   rows = PHP_DRIVER_GET_ROWS(return_value);
+  php_driver_result_options_merge(&rows->options, &self->options);
 
   PHP5TO7_ZVAL_COPY(PHP5TO7_ZVAL_MAYBE_P(rows->rows),
                     PHP5TO7_ZVAL_MAYBE_P(self->rows));
@@ -88,15 +132,59 @@ PHP_METHOD(FutureRows, get)
     rows->session   = php_driver_add_ref(self->session);
     rows->statement = php_driver_add_ref(self->statement);
     rows->result    = php_driver_add_ref(self->result);
+    rows->deadline  = self->deadline;
+  }
+}
+
+PHP_METHOD(FutureRows, await)
+{
+  zval *timeout = NULL;
+
+  if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "|z", &timeout) == FAILURE) {
+    return;
+  }
+
+  if (php_driver_scheduler_await(getThis(), timeout TSRMLS_CC) == FAILURE) {
+    return;
   }
+
+  PHP_MN(FutureRows_get)(INTERNAL_FUNCTION_PARAM_PASSTHRU);
+}
+
+PHP_METHOD(FutureRows, cancel)
+{
+  php_driver_future_rows *self = NULL;
+
+  if (zend_parse_parameters_none() == FAILURE) {
+    return;
+  }
+
+  self = PHP_DRIVER_GET_FUTURE_ROWS(getThis());
+
+  if (!self->future || self->result || cass_future_ready(self->future)) {
+    RETURN_FALSE;
+  }
+
+  /* The driver can't abort a request once it's written, freeing the future
+   * drops its result when it arrives and the request timeout, bounded by
+   * the execution's timeout and deadline, frees its connection */
+  php_driver_future_release(self->future, self->statement TSRMLS_CC);
+  self->future = NULL;
+
+  RETURN_TRUE;
 }
 
 ZEND_BEGIN_ARG_INFO_EX(arginfo_timeout, 0, ZEND_RETURN_VALUE, 0)
   ZEND_ARG_INFO(0, timeout)
 ZEND_END_ARG_INFO()
 
+ZEND_BEGIN_ARG_INFO_EX(arginfo_none, 0, ZEND_RETURN_VALUE, 0)
+ZEND_END_ARG_INFO()
+
 static zend_function_entry php_driver_future_rows_methods[] = {
   PHP_ME(FutureRows, get, arginfo_timeout, ZEND_ACC_PUBLIC)
+  PHP_ME(FutureRows, await, arginfo_timeout, ZEND_ACC_PUBLIC)
+  PHP_ME(FutureRows, cancel, arginfo_none, ZEND_ACC_PUBLIC)
   PHP_FE_END
 };
 
@@ -131,14 +219,23 @@ php_driver_future_rows_free(php5to7_zend_object_free *object TSRMLS_DC)
   php_driver_future_rows *self = PHP5TO7_ZEND_OBJECT_GET(future_rows, object);
 
   PHP5TO7_ZVAL_MAYBE_DESTROY(self->rows);
+  php_driver_result_options_destroy(&self->options);
+
+  if (self->future) {
+    /* Completed without anyone waiting for it */
+    if (self->keyspace && cass_future_ready(self->future) &&
+        cass_future_error_code(self->future) == CASS_OK)
+      follow_keyspace(self);
+    php_driver_future_release(self->future, self->statement TSRMLS_CC);
+  }
 
   php_driver_del_ref(&self->statement);
   php_driver_del_peref(&self->session, 1);
   php_driver_del_ref(&self->result);
+  php_driver_del_peref(&self->prepared_cache, 1);
 
-  if (self->future) {
-    cass_future_free(self->future);
-  }
+  if (self->keyspace)
+    efree(self->keyspace);
 
 #if PHP_VERSION_ID >= 80000
   zend_object_std_dtor(&self->std);
@@ -154,10 +251,14 @@ php_driver_future_rows_new(zend_class_entry *ce TSRMLS_DC)
   php_driver_future_rows *self =
       PHP5TO7_ZEND_OBJECT_ECALLOC(future_rows, ce);
 
-  self->future    = NULL;
-  self->statement = NULL;
-  self->result    = NULL;
-  self->session   = NULL;
+  self->future         = NULL;
+  self->statement      = NULL;
+  self->result         = NULL;
+  self->session        = NULL;
+  self->deadline       = 0;
+  self->prepared_cache = NULL;
+  self->keyspace       = NULL;
+  php_driver_result_options_init(&self->options);
   PHP5TO7_ZVAL_UNDEF(self->rows);
 
   PHP5TO7_ZEND_OBJECT_INIT(future_rows, self, ce);
@@ -174,6 +275,10 @@ void php_driver_define_FutureRows(TSRMLS_D)
   php_driver_future_rows_ce->create_object = php_driver_future_rows_new;
 
   memcpy(&php_driver_future_rows_handlers, zend_get_std_object_handlers(), sizeof(zend_object_handlers));
+#if PHP_VERSION_ID >= 80000
+  php_driver_future_rows_handlers.offset   = XtOffsetOf(php_driver_future_rows, std);
+  php_driver_future_rows_handlers.free_obj = php_driver_future_rows_free;
+#endif
   php_driver_future_rows_handlers.get_properties = php_driver_future_rows_properties;
 #if PHP_VERSION_ID < 80000
   php_driver_future_rows_handlers.compare_objects = php_driver_future_rows_compare;
@@ -20,6 +20,8 @@
 #include "util/future.h"
 #include "util/ref.h"
 
+#include "Scheduler.h"
+
 zend_class_entry *php_driver_future_session_ce = NULL;
 
 PHP_METHOD(FutureSession, get)
@@ -50,6 +52,9 @@ PHP_METHOD(FutureSession, get)
 
   session->session = php_driver_add_ref(self->session);
   session->persist = self->persist;
+  session->auto_prepare = self->auto_prepare;
+  if (self->prepared_cache)
+    session->prepared_cache = php_driver_add_ref(self->prepared_cache);
 
   if (php_driver_future_wait_timed(self->future, timeout TSRMLS_CC) == FAILURE) {
     return;
@@ -83,12 +88,40 @@ PHP_METHOD(FutureSession, get)
   PHP5TO7_ZVAL_COPY(PHP5TO7_ZVAL_MAYBE_P(self->default_session), return_value);
 }
 
+PHP_METHOD(FutureSession, await)
+{
+  zval *timeout = NULL;
+
+  if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "|z", &timeout) == FAILURE) {
+    return;
+  }
+
+  if (php_driver_scheduler_await(getThis(), timeout TSRMLS_CC) == FAILURE) {
+    return;
+  }
+
+  PHP_MN(FutureSession_get)(INTERNAL_FUNCTION_PARAM_PASSTHRU);
+}
+
+PHP_METHOD(FutureSession, cancel)
+{
+  if (zend_parse_parameters_none() == FAILURE)
+    return;
+
+  RETURN_FALSE;
+}
+
 ZEND_BEGIN_ARG_INFO_EX(arginfo_timeout, 0, ZEND_RETURN_VALUE, 0)
   ZEND_ARG_INFO(0, timeout)
 ZEND_END_ARG_INFO()
 
+ZEND_BEGIN_ARG_INFO_EX(arginfo_none, 0, ZEND_RETURN_VALUE, 0)
+ZEND_END_ARG_INFO()
+
 static zend_function_entry php_driver_future_session_methods[] = {
   PHP_ME(FutureSession, get, arginfo_timeout, ZEND_ACC_PUBLIC)
+  PHP_ME(FutureSession, await, arginfo_timeout, ZEND_ACC_PUBLIC)
+  PHP_ME(FutureSession, cancel, arginfo_none, ZEND_ACC_PUBLIC)
   PHP_FE_END
 };
 
@@ -132,6 +165,7 @@ php_driver_future_session_free(php5to7_zend_object_free *object TSRMLS_DC)
   }
 
   php_driver_del_peref(&self->session, 1);
+  php_driver_del_peref(&self->prepared_cache, 1);
 
   if (self->exception_message) {
     efree(self->exception_message);
@@ -158,6 +192,8 @@ php_driver_future_session_new(zend_class_entry *ce TSRMLS_DC)
   self->exception_message = NULL;
   self->hash_key          = NULL;
   self->persist           = 0;
+  self->prepared_cache    = NULL;
+  self->auto_prepare      = 0;
 
   PHP5TO7_ZVAL_UNDEF(self->default_session);
 
@@ -34,12 +34,24 @@ PHP_METHOD(FutureValue, get)
   }
 }
 
+PHP_METHOD(FutureValue, cancel)
+{
+  if (zend_parse_parameters_none() == FAILURE)
+    return;
+
+  RETURN_FALSE;
+}
+
 ZEND_BEGIN_ARG_INFO_EX(arginfo_timeout, 0, ZEND_RETURN_VALUE, 0)
   ZEND_ARG_INFO(0, timeout)
 ZEND_END_ARG_INFO()
 
+ZEND_BEGIN_ARG_INFO_EX(arginfo_none, 0, ZEND_RETURN_VALUE, 0)
+ZEND_END_ARG_INFO()
+
 static zend_function_entry php_driver_future_value_methods[] = {
   PHP_ME(FutureValue, get, arginfo_timeout, ZEND_ACC_PUBLIC)
+  PHP_ME(FutureValue, cancel, arginfo_none, ZEND_ACC_PUBLIC)
   PHP_FE_END
 };
 
@@ -0,0 +1,212 @@
+/**
+ * Copyright 2017 DataStax, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "php_driver.h"
+#include "php_driver_types.h"
+#include "util/future.h"
+
+#include <uv.h>
+
+zend_class_entry *php_driver_futures_ce = NULL;
+
+typedef struct {
+  zval *future;
+  zval key;
+  CassFuture *cass_future;
+  int completed;
+} watched_future;
+
+/* Waits until at least `wanted` futures complete or the timeout expires,
+ * completed futures are added to `completed` as they are seen completing */
+static int
+wait_futures(HashTable *futures, zval *timeout, size_t wanted,
+             zval *completed TSRMLS_DC)
+{
+  watched_future *watched;
+  zend_string *key;
+  zend_ulong index;
+  zval *future;
+  size_t count = 0;
+  size_t done = 0;
+  size_t i;
+  cass_duration_t timeout_us;
+  uint64_t deadline = 0;
+  int rc = SUCCESS;
+
+  ZEND_HASH_FOREACH_VAL(futures, future) {
+    ZVAL_DEREF(future);
+    if (Z_TYPE_P(future) != IS_OBJECT ||
+        !instanceof_function(Z_OBJCE_P(future), php_driver_future_ce TSRMLS_CC)) {
+      throw_invalid_argument(future, "futures",
+                             "an array of instances of " PHP_DRIVER_NAMESPACE "\\Future");
+      return FAILURE;
+    }
+  } ZEND_HASH_FOREACH_END();
+
+  if (php_driver_future_timeout(timeout, &timeout_us TSRMLS_CC) == FAILURE)
+    return FAILURE;
+
+  if (timeout_us)
+    deadline = uv_hrtime() + (uint64_t) timeout_us * 1000;
+
+  array_init(completed);
+
+  watched = (watched_future *) ecalloc(zend_hash_num_elements(futures) + 1,
+                                       sizeof(watched_future));
+
+  ZEND_HASH_FOREACH_KEY_VAL(futures, index, key, future) {
+    watched_future *current = &watched[count++];
+
+    ZVAL_DEREF(future);
+    current->future = future;
+    if (key) {
+      ZVAL_STR(&current->key, key);
+    } else {
+      ZVAL_LONG(&current->key, index);
+    }
+
+    current->cass_future = php_driver_future_get(future);
+    if (current->cass_future)
+      php_driver_future_watch(current->cass_future);
+  } ZEND_HASH_FOREACH_END();
+
+  while (1) {
+    unsigned long completions = php_driver_future_completions();
+
+    for (i = 0; i < count; i++) {
+      watched_future *current = &watched[i];
+
+      if (current->completed ||
+          (current->cass_future && !cass_future_ready(current->cass_future)))
+        continue;
+
+      current->completed = 1;
+      done++;
+      array_set_zval_key(Z_ARRVAL_P(completed), &current->key, current->future);
+    }
+
+    if (done >= wanted)
+      break;
+
+    if (php_driver_future_wait_completion(completions, deadline) == FAILURE) {
+      rc = FAILURE;
+      break;
+    }
+  }
+
+  efree(watched);
+  return rc;
+}
+
+PHP_METHOD(Futures, __construct)
+{
+}
+
+PHP_METHOD(Futures, all)
+{
+  zval *futures;
+  zval *timeout = NULL;
+
+  if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "a|z", &futures, &timeout) == FAILURE) {
+    return;
+  }
+
+  if (wait_futures(Z_ARRVAL_P(futures), timeout,
+                   zend_hash_num_elements(Z_ARRVAL_P(futures)),
+                   return_value TSRMLS_CC) == FAILURE && !EG(exception)) {
+    zend_throw_exception_ex(php_driver_timeout_exception_ce, 0 TSRMLS_CC,
+                            "Futures haven't resolved within the timeout");
+  }
+}
+
+PHP_METHOD(Futures, any)
+{
+  zval *futures;
+  zval *timeout = NULL;
+  zval completed;
+  zval *first;
+
+  if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "a|z", &futures, &timeout) == FAILURE) {
+    return;
+  }
+
+  if (zend_hash_num_elements(Z_ARRVAL_P(futures)) == 0) {
+    INVALID_ARGUMENT(futures, "a non-empty array of instances of " PHP_DRIVER_NAMESPACE "\\Future");
+  }
+
+  ZVAL_UNDEF(&completed);
+  if (wait_futures(Z_ARRVAL_P(futures), timeout, 1, &completed TSRMLS_CC) == FAILURE) {
+    if (!EG(exception)) {
+      zend_throw_exception_ex(php_driver_timeout_exception_ce, 0 TSRMLS_CC,
+                              "Futures haven't resolved within the timeout");
+    }
+  } else {
+    first = zend_hash_get_current_data(Z_ARRVAL(completed));
+    RETVAL_ZVAL(first, 1, 0);
+  }
+
+  zval_ptr_dtor(&completed);
+}
+
+PHP_METHOD(Futures, select)
+{
+  zval *futures;
+  zval *timeout = NULL;
+
+  if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "a|z", &futures, &timeout) == FAILURE) {
+    return;
+  }
+
+  /* Nothing to wait for */
+  if (zend_hash_num_elements(Z_ARRVAL_P(futures)) == 0) {
+    array_init(return_value);
+    return;
+  }
+
+  /* Timing out returns the futures completed so far, none */
+  wait_futures(Z_ARRVAL_P(futures), timeout, 1, return_value TSRMLS_CC);
+}
+
+#if PHP_VERSION_ID >= 80100
+/* Constructors cannot declare a return type; use untyped arginfo */
+ZEND_BEGIN_ARG_INFO_EX(arginfo_none, 0, 0, 0)
+ZEND_END_ARG_INFO()
+#else
+ZEND_BEGIN_ARG_INFO_EX(arginfo_none, 0, ZEND_RETURN_VALUE, 0)
+ZEND_END_ARG_INFO()
+#endif
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_futures, 0, ZEND_RETURN_VALUE, 1)
+  ZEND_ARG_ARRAY_INFO(0, futures, 0)
+  ZEND_ARG_INFO(0, timeout)
+ZEND_END_ARG_INFO()
+
+static zend_function_entry php_driver_futures_methods[] = {
+  PHP_ME(Futures, __construct, arginfo_none, ZEND_ACC_PRIVATE | ZEND_ACC_CTOR)
+  PHP_ME(Futures, all, arginfo_futures, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+  PHP_ME(Futures, any, arginfo_futures, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+  PHP_ME(Futures, select, arginfo_futures, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+  PHP_FE_END
+};
+
+void php_driver_define_Futures(TSRMLS_D)
+{
+  zend_class_entry ce;
+
+  INIT_CLASS_ENTRY(ce, PHP_DRIVER_NAMESPACE "\\Futures", php_driver_futures_methods);
+  php_driver_futures_ce = zend_register_internal_class(&ce TSRMLS_CC);
+  php_driver_futures_ce->ce_flags |= PHP5TO7_ZEND_ACC_FINAL;
+}
@@ -52,6 +52,7 @@ php_driver_map_set(php_driver_map *map, zval *zkey, zval *zvalue TSRMLS_DC)
   }
 
   map->dirty = 1;
+  PHP_DRIVER_CLEAR_ENCODED(map);
   HASH_FIND_ZVAL(map->entries, zkey, entry);
   if (entry == NULL) {
     entry = (php_driver_map_entry *) emalloc(sizeof(php_driver_map_entry));
@@ -105,6 +106,7 @@ php_driver_map_del(php_driver_map *map, zval *zkey TSRMLS_DC)
   HASH_FIND_ZVAL(map->entries, zkey, entry);
   if (entry != NULL) {
     map->dirty = 1;
+    PHP_DRIVER_CLEAR_ENCODED(map);
     if (entry == map->iter_temp) {
       map->iter_temp = (php_driver_map_entry *)map->iter_temp->hh.next;
     }
@@ -708,7 +710,6 @@ php_driver_map_hash_value(zval *obj TSRMLS_DC)
   return hashv;
 }
 
-#if PHP_VERSION_ID < 80000
 static void
 php_driver_map_free(php5to7_zend_object_free *object TSRMLS_DC)
 {
@@ -723,11 +724,15 @@ php_driver_map_free(php5to7_zend_object_free *object TSRMLS_DC)
   }
 
   PHP5TO7_ZVAL_MAYBE_DESTROY(self->type);
+  PHP_DRIVER_CLEAR_ENCODED(self);
 
+#if PHP_VERSION_ID >= 80000
+  zend_object_std_dtor(&self->std);
+#else
   zend_object_std_dtor(&self->zval TSRMLS_CC);
+#endif
   PHP5TO7_MAYBE_EFREE(self);
 }
-#endif
 
 static php5to7_zend_object
 php_driver_map_new(zend_class_entry *ce TSRMLS_DC)
@@ -775,4 +780,7 @@ void php_driver_define_Map(TSRMLS_D)
   zend_class_implements(php_driver_map_ce TSRMLS_CC, 3, spl_ce_Countable, zend_ce_iterator, zend_ce_arrayaccess);
 #endif
   php_driver_map_handlers.clone_obj = NULL;
+#if PHP_MAJOR_VERSION >= 7
+  php_driver_map_handlers.free_obj = php_driver_map_free;
+#endif
 }
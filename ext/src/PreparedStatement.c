@@ -16,6 +16,8 @@
 
 #include "php_driver.h"
 #include "php_driver_types.h"
+#include "util/bind.h"
+#include "BoundStatement.h"
 
 zend_class_entry *php_driver_prepared_statement_ce = NULL;
 
@@ -23,6 +25,18 @@ PHP_METHOD(PreparedStatement, __construct)
 {
 }
 
+PHP_METHOD(PreparedStatement, bind)
+{
+  zval *arguments = NULL;
+
+  if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "|a!", &arguments) == FAILURE) {
+    return;
+  }
+
+  php_driver_bound_statement_init(return_value, getThis(),
+                                  arguments ? Z_ARRVAL_P(arguments) : NULL TSRMLS_CC);
+}
+
 #if PHP_VERSION_ID >= 80100
 /* Constructors cannot declare a return type; use untyped arginfo */
 ZEND_BEGIN_ARG_INFO_EX(arginfo_none, 0, 0, 0)
@@ -32,8 +46,13 @@ ZEND_BEGIN_ARG_INFO_EX(arginfo_none, 0, ZEND_RETURN_VALUE, 0)
 ZEND_END_ARG_INFO()
 #endif
 
+ZEND_BEGIN_ARG_INFO_EX(arginfo_bind, 0, ZEND_RETURN_VALUE, 0)
+  ZEND_ARG_ARRAY_INFO(0, arguments, 1)
+ZEND_END_ARG_INFO()
+
 static zend_function_entry php_driver_prepared_statement_methods[] = {
   PHP_ME(PreparedStatement, __construct, arginfo_none, ZEND_ACC_PRIVATE | ZEND_ACC_CTOR)
+  PHP_ME(PreparedStatement, bind, arginfo_bind, ZEND_ACC_PUBLIC)
   PHP_FE_END
 };
 
@@ -69,6 +88,9 @@ php_driver_prepared_statement_free(php5to7_zend_object_free *object TSRMLS_DC)
 
   if (self->data.prepared.prepared)
     cass_prepared_free(self->data.prepared.prepared);
+  if (self->data.prepared.keyspace)
+    efree(self->data.prepared.keyspace);
+  php_driver_bind_plan_destroy(self);
 
 #if PHP_VERSION_ID >= 80000
   zend_object_std_dtor(&self->std);
@@ -86,6 +108,12 @@ php_driver_prepared_statement_new(zend_class_entry *ce TSRMLS_DC)
 
   self->type = PHP_DRIVER_PREPARED_STATEMENT;
   self->data.prepared.prepared = NULL;
+  self->data.prepared.binders = NULL;
+  self->data.prepared.binder_count = 0;
+#if PHP_MAJOR_VERSION >= 7
+  self->data.prepared.parameter_indices = NULL;
+#endif
+  self->data.prepared.keyspace = NULL;
 
   PHP5TO7_ZEND_OBJECT_INIT_EX(statement, prepared_statement, self, ce);
 }
@@ -105,6 +133,9 @@ void php_driver_define_PreparedStatement(TSRMLS_D)
   /* compare_objects was removed in PHP 8 */
 #if PHP_VERSION_ID < 80000
   php_driver_prepared_statement_handlers.compare_objects = php_driver_prepared_statement_compare;
+#endif
+#if PHP_MAJOR_VERSION >= 7
+  php_driver_prepared_statement_handlers.free_obj = php_driver_prepared_statement_free;
 #endif
   php_driver_prepared_statement_handlers.clone_obj = NULL;
 }
@@ -0,0 +1,444 @@
+/**
+ * Copyright 2015-2017 DataStax, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "php_driver.h"
+#include "php_driver_types.h"
+#include "util/ref.h"
+#include "util/result.h"
+
+#include "Row.h"
+
+zend_class_entry *php_driver_row_ce = NULL;
+
+void
+php_driver_row_init(zval *row, php_driver_ref *cursor, size_t index TSRMLS_DC)
+{
+  php_driver_row *self;
+
+  object_init_ex(row, php_driver_row_ce);
+  self = PHP_DRIVER_GET_ROW(row);
+
+  self->cursor = php_driver_add_ref(cursor);
+  self->index  = index;
+}
+
+static php_driver_result_plan *
+php_driver_row_plan(php_driver_row *self)
+{
+  return ((php_driver_result_cursor *) self->cursor->data)->plan;
+}
+
+static int
+php_driver_row_position(php_driver_row *self, zval *offset, size_t *position TSRMLS_DC)
+{
+  php_driver_result_plan *plan = php_driver_row_plan(self);
+
+  if (Z_TYPE_P(offset) == IS_LONG) {
+    if (Z_LVAL_P(offset) < 0 || (size_t) Z_LVAL_P(offset) >= plan->column_count) {
+      return FAILURE;
+    }
+    *position = (size_t) Z_LVAL_P(offset);
+    return SUCCESS;
+  }
+
+  if (Z_TYPE_P(offset) == IS_STRING) {
+#if PHP_MAJOR_VERSION >= 7
+    return php_driver_result_plan_position(plan, Z_STR_P(offset), position);
+#else
+    size_t i;
+    for (i = 0; i < plan->column_count; i++) {
+      if (strcmp(plan->column_names[i], Z_STRVAL_P(offset)) == 0) {
+        *position = i;
+        return SUCCESS;
+      }
+    }
+#endif
+  }
+
+  return FAILURE;
+}
+
+/* Decodes a single cell, the first time it is accessed only */
+static int
+php_driver_row_get(php_driver_row *self, size_t position, zval *return_value TSRMLS_DC)
+{
+  php5to7_zval *entry;
+  php5to7_zval value;
+  const CassRow *row;
+  php_driver_result_cursor *cursor = (php_driver_result_cursor *) self->cursor->data;
+
+  if (PHP5TO7_ZVAL_IS_UNDEF(self->values)) {
+    PHP5TO7_ZVAL_MAYBE_MAKE(self->values);
+    array_init_size(PHP5TO7_ZVAL_MAYBE_P(self->values), cursor->plan->column_count);
+  } else if (PHP5TO7_ZEND_HASH_INDEX_FIND(PHP5TO7_Z_ARRVAL_MAYBE_P(self->values), position, entry)) {
+    RETVAL_ZVAL(PHP5TO7_ZVAL_MAYBE_DEREF(entry), 1, 0);
+    return SUCCESS;
+  }
+
+  row = php_driver_result_cursor_seek(cursor, self->index);
+  if (row == NULL ||
+      php_driver_decode(cass_row_get_column(row, cursor->plan->columns[position]),
+                        &cursor->plan->decoders[position], &value TSRMLS_CC) == FAILURE) {
+    return FAILURE;
+  }
+
+  PHP5TO7_ZEND_HASH_INDEX_UPDATE(PHP5TO7_Z_ARRVAL_MAYBE_P(self->values), position,
+                                 PHP5TO7_ZVAL_MAYBE_P(value), sizeof(php5to7_zval));
+  RETVAL_ZVAL(PHP5TO7_ZVAL_MAYBE_P(value), 1, 0);
+  return SUCCESS;
+}
+
+static int
+php_driver_row_populate(php_driver_row *self, zval *array TSRMLS_DC)
+{
+  size_t i;
+  php_driver_result_plan *plan = php_driver_row_plan(self);
+
+  for (i = 0; i < plan->column_count; i++) {
+    php5to7_zval value;
+
+    PHP5TO7_ZVAL_MAYBE_MAKE(value);
+    if (php_driver_row_get(self, i, PHP5TO7_ZVAL_MAYBE_P(value) TSRMLS_CC) == FAILURE) {
+      PHP5TO7_ZVAL_MAYBE_DESTROY(value);
+      return FAILURE;
+    }
+
+#if PHP_MAJOR_VERSION >= 7
+    zend_symtable_update(Z_ARRVAL_P(array), plan->column_names[i], &value);
+#else
+    PHP5TO7_ADD_ASSOC_ZVAL_EX(array,
+                              plan->column_names[i], strlen(plan->column_names[i]) + 1,
+                              PHP5TO7_ZVAL_MAYBE_P(value));
+#endif
+  }
+
+  return SUCCESS;
+}
+
+static void
+php_driver_row_unknown_column(zval *offset TSRMLS_DC)
+{
+  if (Z_TYPE_P(offset) == IS_STRING) {
+    zend_throw_exception_ex(php_driver_invalid_argument_exception_ce, 0 TSRMLS_CC,
+                            "Unknown column '%s'", Z_STRVAL_P(offset));
+  } else {
+    throw_invalid_argument(offset, "offset", "a column name or position" TSRMLS_CC);
+  }
+}
+
+PHP_METHOD(Row, __construct)
+{
+  zend_throw_exception_ex(php_driver_logic_exception_ce, 0 TSRMLS_CC,
+    "Instantiation of a " PHP_DRIVER_NAMESPACE "\\Row objects directly is not supported, " \
+    "enable the row_objects execution option instead."
+  );
+  return;
+}
+
+PHP_METHOD(Row, count)
+{
+  php_driver_row *self = NULL;
+
+  if (zend_parse_parameters_none() == FAILURE)
+    return;
+
+  self = PHP_DRIVER_GET_ROW(getThis());
+
+  RETURN_LONG(php_driver_row_plan(self)->column_count);
+}
+
+PHP_METHOD(Row, toArray)
+{
+  php_driver_row *self = NULL;
+
+  if (zend_parse_parameters_none() == FAILURE)
+    return;
+
+  self = PHP_DRIVER_GET_ROW(getThis());
+
+  array_init_size(return_value, php_driver_row_plan(self)->column_count);
+  php_driver_row_populate(self, return_value TSRMLS_CC);
+}
+
+PHP_METHOD(Row, offsetExists)
+{
+  zval *offset;
+  size_t position;
+  php_driver_row *self = NULL;
+
+  if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z", &offset) == FAILURE)
+    return;
+
+  self = PHP_DRIVER_GET_ROW(getThis());
+
+  RETURN_BOOL(php_driver_row_position(self, offset, &position TSRMLS_CC) == SUCCESS);
+}
+
+PHP_METHOD(Row, offsetGet)
+{
+  zval *offset;
+  size_t position;
+  php_driver_row *self = NULL;
+
+  if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z", &offset) == FAILURE)
+    return;
+
+  self = PHP_DRIVER_GET_ROW(getThis());
+
+  if (php_driver_row_position(self, offset, &position TSRMLS_CC) == FAILURE) {
+    php_driver_row_unknown_column(offset TSRMLS_CC);
+    return;
+  }
+
+  php_driver_row_get(self, position, return_value TSRMLS_CC);
+}
+
+PHP_METHOD(Row, offsetSet)
+{
+  if (zend_parse_parameters_none() == FAILURE)
+    return;
+
+  zend_throw_exception_ex(php_driver_domain_exception_ce, 0 TSRMLS_CC,
+    "Cannot overwrite a column of a row, rows are immutable."
+  );
+  return;
+}
+
+PHP_METHOD(Row, offsetUnset)
+{
+  if (zend_parse_parameters_none() == FAILURE)
+    return;
+
+  zend_throw_exception_ex(php_driver_domain_exception_ce, 0 TSRMLS_CC,
+    "Cannot delete a column of a row, rows are immutable."
+  );
+  return;
+}
+
+PHP_METHOD(Row, __get)
+{
+  zval *name;
+  size_t position;
+  php_driver_row *self = NULL;
+
+  if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z", &name) == FAILURE)
+    return;
+
+  self = PHP_DRIVER_GET_ROW(getThis());
+
+  if (php_driver_row_position(self, name, &position TSRMLS_CC) == FAILURE) {
+    php_driver_row_unknown_column(name TSRMLS_CC);
+    return;
+  }
+
+  php_driver_row_get(self, position, return_value TSRMLS_CC);
+}
+
+PHP_METHOD(Row, __isset)
+{
+  zval *name;
+  size_t position;
+  php_driver_row *self = NULL;
+
+  if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z", &name) == FAILURE)
+    return;
+
+  self = PHP_DRIVER_GET_ROW(getThis());
+
+  RETURN_BOOL(php_driver_row_position(self, name, &position TSRMLS_CC) == SUCCESS);
+}
+
+#if PHP_VERSION_ID >= 80100
+ZEND_BEGIN_ARG_INFO_EX(arginfo_ctor_none, 0, 0, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_count, 0, 0, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_array, 0, 0, IS_ARRAY, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_offset_exists, 0, 1, _IS_BOOL, 0)
+  ZEND_ARG_INFO(0, offset)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_offset_get, 0, 1, IS_MIXED, 0)
+  ZEND_ARG_INFO(0, offset)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_offset_set, 0, 2, IS_VOID, 0)
+  ZEND_ARG_INFO(0, offset)
+  ZEND_ARG_INFO(0, value)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_offset_unset, 0, 1, IS_VOID, 0)
+  ZEND_ARG_INFO(0, offset)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_get, 0, 1, IS_MIXED, 0)
+  ZEND_ARG_INFO(0, name)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_isset, 0, 1, _IS_BOOL, 0)
+  ZEND_ARG_INFO(0, name)
+ZEND_END_ARG_INFO()
+#else
+ZEND_BEGIN_ARG_INFO_EX(arginfo_none, 0, ZEND_RETURN_VALUE, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_offset, 0, ZEND_RETURN_VALUE, 1)
+  ZEND_ARG_INFO(0, offset)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_set, 0, ZEND_RETURN_VALUE, 2)
+  ZEND_ARG_INFO(0, offset)
+  ZEND_ARG_INFO(0, value)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_name, 0, ZEND_RETURN_VALUE, 1)
+  ZEND_ARG_INFO(0, name)
+ZEND_END_ARG_INFO()
+#endif
+
+static zend_function_entry php_driver_row_methods[] = {
+#if PHP_VERSION_ID >= 80100
+  PHP_ME(Row, __construct,  arginfo_ctor_none,     ZEND_ACC_PUBLIC | ZEND_ACC_CTOR)
+  PHP_ME(Row, count,        arginfo_count,         ZEND_ACC_PUBLIC)
+  PHP_ME(Row, toArray,      arginfo_array,         ZEND_ACC_PUBLIC)
+  PHP_ME(Row, offsetExists, arginfo_offset_exists, ZEND_ACC_PUBLIC)
+  PHP_ME(Row, offsetGet,    arginfo_offset_get,    ZEND_ACC_PUBLIC)
+  PHP_ME(Row, offsetSet,    arginfo_offset_set,    ZEND_ACC_PUBLIC)
+  PHP_ME(Row, offsetUnset,  arginfo_offset_unset,  ZEND_ACC_PUBLIC)
+  PHP_ME(Row, __get,        arginfo_get,           ZEND_ACC_PUBLIC)
+  PHP_ME(Row, __isset,      arginfo_isset,         ZEND_ACC_PUBLIC)
+#else
+  PHP_ME(Row, __construct,  arginfo_none,   ZEND_ACC_PUBLIC | ZEND_ACC_CTOR)
+  PHP_ME(Row, count,        arginfo_none,   ZEND_ACC_PUBLIC)
+  PHP_ME(Row, toArray,      arginfo_none,   ZEND_ACC_PUBLIC)
+  PHP_ME(Row, offsetExists, arginfo_offset, ZEND_ACC_PUBLIC)
+  PHP_ME(Row, offsetGet,    arginfo_offset, ZEND_ACC_PUBLIC)
+  PHP_ME(Row, offsetSet,    arginfo_set,    ZEND_ACC_PUBLIC)
+  PHP_ME(Row, offsetUnset,  arginfo_offset, ZEND_ACC_PUBLIC)
+  PHP_ME(Row, __get,        arginfo_name,   ZEND_ACC_PUBLIC)
+  PHP_ME(Row, __isset,      arginfo_name,   ZEND_ACC_PUBLIC)
+#endif
+  PHP_FE_END
+};
+
+static zend_object_handlers php_driver_row_handlers;
+
+#if PHP_VERSION_ID >= 80000
+static HashTable *
+php_driver_row_properties(zend_object *object)
+{
+  zval values;
+
+  php_driver_row *self = php_driver_row_object_fetch(object);
+  HashTable *props = zend_std_get_properties(object);
+
+  array_init(&values);
+  /* Leaves the exception of the cell that failed to decode */
+  if (php_driver_row_populate(self, &values) == FAILURE) {
+    zval_ptr_dtor(&values);
+    return props;
+  }
+  zend_hash_str_update(props, "values", sizeof("values") - 1, &values);
+
+  return props;
+}
+
+/* Only the cells decoded so far, collecting cycles mustn't decode a row */
+static HashTable *
+php_driver_row_gc(zend_object *object, zval **table, int *n)
+{
+  php_driver_row *self = php_driver_row_object_fetch(object);
+
+  *table = Z_TYPE(self->values) == IS_UNDEF ? NULL : &self->values;
+  *n = *table ? 1 : 0;
+  return zend_std_get_properties(object);
+}
+#else
+static HashTable *
+php_driver_row_properties(zval *object TSRMLS_DC)
+{
+  return zend_std_get_properties(object TSRMLS_CC);
+}
+#endif
+
+static int
+php_driver_row_compare(zval *obj1, zval *obj2 TSRMLS_DC)
+{
+  if (Z_OBJCE_P(obj1) != Z_OBJCE_P(obj2))
+    return 1; /* different classes */
+
+  return Z_OBJ_HANDLE_P(obj1) != Z_OBJ_HANDLE_P(obj2);
+}
+
+static void
+php_driver_row_free(php5to7_zend_object_free *object TSRMLS_DC)
+{
+  php_driver_row *self = PHP5TO7_ZEND_OBJECT_GET(row, object);
+
+  php_driver_del_ref(&self->cursor);
+  PHP5TO7_ZVAL_MAYBE_DESTROY(self->values);
+
+#if PHP_VERSION_ID >= 80000
+  zend_object_std_dtor(&self->std);
+#else
+  zend_object_std_dtor(&self->zval TSRMLS_CC);
+#endif
+  PHP5TO7_MAYBE_EFREE(self);
+}
+
+static php5to7_zend_object
+php_driver_row_new(zend_class_entry *ce TSRMLS_DC)
+{
+  php_driver_row *self =
+      PHP5TO7_ZEND_OBJECT_ECALLOC(row, ce);
+
+  self->cursor = NULL;
+  self->index  = 0;
+  PHP5TO7_ZVAL_UNDEF(self->values);
+
+  PHP5TO7_ZEND_OBJECT_INIT(row, self, ce);
+}
+
+void php_driver_define_Row(TSRMLS_D)
+{
+  zend_class_entry ce;
+
+  INIT_CLASS_ENTRY(ce, PHP_DRIVER_NAMESPACE "\\Row", php_driver_row_methods);
+  php_driver_row_ce = zend_register_internal_class(&ce TSRMLS_CC);
+#if PHP_VERSION_ID >= 80000
+  zend_class_implements(php_driver_row_ce, 2, zend_ce_countable, zend_ce_arrayaccess);
+#else
+  zend_class_implements(php_driver_row_ce TSRMLS_CC, 2, spl_ce_Countable, zend_ce_arrayaccess);
+#endif
+  php_driver_row_ce->ce_flags     |= PHP5TO7_ZEND_ACC_FINAL;
+  php_driver_row_ce->create_object = php_driver_row_new;
+
+  memcpy(&php_driver_row_handlers, zend_get_std_object_handlers(), sizeof(zend_object_handlers));
+#if PHP_VERSION_ID >= 80000
+  php_driver_row_handlers.offset   = XtOffsetOf(php_driver_row, std);
+  php_driver_row_handlers.free_obj = php_driver_row_free;
+  php_driver_row_handlers.get_gc   = php_driver_row_gc;
+#endif
+  php_driver_row_handlers.get_properties = php_driver_row_properties;
+#if PHP_VERSION_ID < 80000
+  php_driver_row_handlers.compare_objects = php_driver_row_compare;
+#endif
+  php_driver_row_handlers.clone_obj = NULL;
+}
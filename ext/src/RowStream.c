@@ -0,0 +1,282 @@
+/**
+ * Copyright 2015-2017 DataStax, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "php_driver.h"
+#include "php_driver_types.h"
+#include "util/result.h"
+
+#include "Rows.h"
+#include "RowStream.h"
+
+zend_class_entry *php_driver_row_stream_ce = NULL;
+
+/* Moves to the following pages until the current position points to a row,
+ * the next page is requested as soon as a page arrives when prefetching so
+ * that it's fetched while the rows of the current page are processed. */
+static int
+php_driver_row_stream_fill(php_driver_row_stream *self TSRMLS_DC)
+{
+  php_driver_rows *rows = PHP_DRIVER_GET_ROWS(PHP5TO7_ZVAL_MAYBE_P(self->rows));
+
+  while (self->position >= php_driver_rows_count(rows)) {
+    php5to7_zval next;
+
+    PHP5TO7_ZVAL_MAYBE_MAKE(next);
+    ZVAL_NULL(PHP5TO7_ZVAL_MAYBE_P(next));
+
+    php_driver_rows_next_page(rows,
+                              PHP5TO7_ZVAL_IS_UNDEF(self->timeout) ? NULL : PHP5TO7_ZVAL_MAYBE_P(self->timeout),
+                              PHP5TO7_ZVAL_MAYBE_P(next) TSRMLS_CC);
+
+    if (Z_TYPE_P(PHP5TO7_ZVAL_MAYBE_P(next)) != IS_OBJECT) {
+      /* Either the last page was reached or an exception was thrown */
+      zval_ptr_dtor(&next);
+      return EG(exception) ? FAILURE : SUCCESS;
+    }
+
+    zval_ptr_dtor(&self->rows);
+    self->rows     = next;
+    self->position = 0;
+    self->advanced = 1;
+
+    rows = PHP_DRIVER_GET_ROWS(PHP5TO7_ZVAL_MAYBE_P(self->rows));
+    if (self->prefetch) {
+      php_driver_rows_request_next_page(rows TSRMLS_CC);
+    }
+  }
+
+  return SUCCESS;
+}
+
+void
+php_driver_row_stream_init(zval *stream, zval *rows, int prefetch, zval *timeout TSRMLS_DC)
+{
+  php_driver_row_stream *self;
+
+  object_init_ex(stream, php_driver_row_stream_ce);
+  self = PHP_DRIVER_GET_ROW_STREAM(stream);
+
+  PHP5TO7_ZVAL_COPY(PHP5TO7_ZVAL_MAYBE_P(self->rows), rows);
+  if (timeout && Z_TYPE_P(timeout) != IS_NULL) {
+    PHP5TO7_ZVAL_COPY(PHP5TO7_ZVAL_MAYBE_P(self->timeout), timeout);
+  }
+  self->prefetch = prefetch;
+
+  if (self->prefetch) {
+    php_driver_rows_request_next_page(PHP_DRIVER_GET_ROWS(rows) TSRMLS_CC);
+  }
+
+  php_driver_row_stream_fill(self TSRMLS_CC);
+}
+
+PHP_METHOD(RowStream, __construct)
+{
+  zend_throw_exception_ex(php_driver_logic_exception_ce, 0 TSRMLS_CC,
+    "Instantiation of a " PHP_DRIVER_NAMESPACE "\\RowStream objects directly is not supported, " \
+    "call " PHP_DRIVER_NAMESPACE "\\Rows::stream() instead."
+  );
+  return;
+}
+
+PHP_METHOD(RowStream, rewind)
+{
+  php_driver_row_stream *self = NULL;
+
+  if (zend_parse_parameters_none() == FAILURE)
+    return;
+
+  self = PHP_DRIVER_GET_ROW_STREAM(getThis());
+
+  if (self->advanced) {
+    zend_throw_exception_ex(php_driver_logic_exception_ce, 0 TSRMLS_CC,
+                            "Cannot rewind a row stream once it moved past its first page");
+    return;
+  }
+
+  self->position = 0;
+  self->key      = 0;
+  php_driver_row_stream_fill(self TSRMLS_CC);
+}
+
+PHP_METHOD(RowStream, current)
+{
+  php_driver_row_stream *self = NULL;
+
+  if (zend_parse_parameters_none() == FAILURE)
+    return;
+
+  self = PHP_DRIVER_GET_ROW_STREAM(getThis());
+
+  php_driver_rows_at(PHP_DRIVER_GET_ROWS(PHP5TO7_ZVAL_MAYBE_P(self->rows)),
+                     self->position, return_value TSRMLS_CC);
+}
+
+PHP_METHOD(RowStream, key)
+{
+  php_driver_row_stream *self = NULL;
+
+  if (zend_parse_parameters_none() == FAILURE)
+    return;
+
+  self = PHP_DRIVER_GET_ROW_STREAM(getThis());
+
+  if (self->position < php_driver_rows_count(PHP_DRIVER_GET_ROWS(PHP5TO7_ZVAL_MAYBE_P(self->rows))))
+    RETURN_LONG(self->key);
+}
+
+PHP_METHOD(RowStream, next)
+{
+  php_driver_row_stream *self = NULL;
+
+  if (zend_parse_parameters_none() == FAILURE)
+    return;
+
+  self = PHP_DRIVER_GET_ROW_STREAM(getThis());
+
+  self->position++;
+  self->key++;
+  php_driver_row_stream_fill(self TSRMLS_CC);
+}
+
+PHP_METHOD(RowStream, valid)
+{
+  php_driver_row_stream *self = NULL;
+
+  if (zend_parse_parameters_none() == FAILURE)
+    return;
+
+  self = PHP_DRIVER_GET_ROW_STREAM(getThis());
+
+  RETURN_BOOL(self->position < php_driver_rows_count(PHP_DRIVER_GET_ROWS(PHP5TO7_ZVAL_MAYBE_P(self->rows))));
+}
+
+#if PHP_VERSION_ID >= 80100
+ZEND_BEGIN_ARG_INFO_EX(arginfo_ctor_none, 0, 0, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_none, 0, 0, IS_VOID, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_bool, 0, 0, _IS_BOOL, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_mixed, 0, 0, IS_MIXED, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_MASK_EX(arginfo_key_maybe_long, 0, 0, MAY_BE_LONG|MAY_BE_NULL)
+ZEND_END_ARG_INFO()
+#else
+ZEND_BEGIN_ARG_INFO_EX(arginfo_none, 0, ZEND_RETURN_VALUE, 0)
+ZEND_END_ARG_INFO()
+#endif
+
+static zend_function_entry php_driver_row_stream_methods[] = {
+#if PHP_VERSION_ID >= 80100
+  PHP_ME(RowStream, __construct, arginfo_ctor_none,      ZEND_ACC_PUBLIC | ZEND_ACC_CTOR)
+  PHP_ME(RowStream, rewind,      arginfo_none,           ZEND_ACC_PUBLIC)
+  PHP_ME(RowStream, current,     arginfo_mixed,          ZEND_ACC_PUBLIC)
+  PHP_ME(RowStream, key,         arginfo_key_maybe_long, ZEND_ACC_PUBLIC)
+  PHP_ME(RowStream, next,        arginfo_none,           ZEND_ACC_PUBLIC)
+  PHP_ME(RowStream, valid,       arginfo_bool,           ZEND_ACC_PUBLIC)
+#else
+  PHP_ME(RowStream, __construct, arginfo_none, ZEND_ACC_PUBLIC | ZEND_ACC_CTOR)
+  PHP_ME(RowStream, rewind,      arginfo_none, ZEND_ACC_PUBLIC)
+  PHP_ME(RowStream, current,     arginfo_none, ZEND_ACC_PUBLIC)
+  PHP_ME(RowStream, key,         arginfo_none, ZEND_ACC_PUBLIC)
+  PHP_ME(RowStream, next,        arginfo_none, ZEND_ACC_PUBLIC)
+  PHP_ME(RowStream, valid,       arginfo_none, ZEND_ACC_PUBLIC)
+#endif
+  PHP_FE_END
+};
+
+static zend_object_handlers php_driver_row_stream_handlers;
+
+#if PHP_VERSION_ID >= 80000
+static HashTable *
+php_driver_row_stream_properties(zend_object *object)
+{
+  return zend_std_get_properties(object);
+}
+#else
+static HashTable *
+php_driver_row_stream_properties(zval *object TSRMLS_DC)
+{
+  return zend_std_get_properties(object TSRMLS_CC);
+}
+#endif
+
+static int
+php_driver_row_stream_compare(zval *obj1, zval *obj2 TSRMLS_DC)
+{
+  if (Z_OBJCE_P(obj1) != Z_OBJCE_P(obj2))
+    return 1; /* different classes */
+
+  return Z_OBJ_HANDLE_P(obj1) != Z_OBJ_HANDLE_P(obj2);
+}
+
+static void
+php_driver_row_stream_free(php5to7_zend_object_free *object TSRMLS_DC)
+{
+  php_driver_row_stream *self = PHP5TO7_ZEND_OBJECT_GET(row_stream, object);
+
+  PHP5TO7_ZVAL_MAYBE_DESTROY(self->rows);
+  PHP5TO7_ZVAL_MAYBE_DESTROY(self->timeout);
+
+#if PHP_VERSION_ID >= 80000
+  zend_object_std_dtor(&self->std);
+#else
+  zend_object_std_dtor(&self->zval TSRMLS_CC);
+#endif
+  PHP5TO7_MAYBE_EFREE(self);
+}
+
+static php5to7_zend_object
+php_driver_row_stream_new(zend_class_entry *ce TSRMLS_DC)
+{
+  php_driver_row_stream *self =
+      PHP5TO7_ZEND_OBJECT_ECALLOC(row_stream, ce);
+
+  self->position = 0;
+  self->key      = 0;
+  self->prefetch = 0;
+  self->advanced = 0;
+  PHP5TO7_ZVAL_UNDEF(self->rows);
+  PHP5TO7_ZVAL_UNDEF(self->timeout);
+
+  PHP5TO7_ZEND_OBJECT_INIT(row_stream, self, ce);
+}
+
+void php_driver_define_RowStream(TSRMLS_D)
+{
+  zend_class_entry ce;
+
+  INIT_CLASS_ENTRY(ce, PHP_DRIVER_NAMESPACE "\\RowStream", php_driver_row_stream_methods);
+  php_driver_row_stream_ce = zend_register_internal_class(&ce TSRMLS_CC);
+  zend_class_implements(php_driver_row_stream_ce TSRMLS_CC, 1, zend_ce_iterator);
+  php_driver_row_stream_ce->ce_flags     |= PHP5TO7_ZEND_ACC_FINAL;
+  php_driver_row_stream_ce->create_object = php_driver_row_stream_new;
+
+  memcpy(&php_driver_row_stream_handlers, zend_get_std_object_handlers(), sizeof(zend_object_handlers));
+#if PHP_VERSION_ID >= 80000
+  php_driver_row_stream_handlers.offset   = XtOffsetOf(php_driver_row_stream, std);
+  php_driver_row_stream_handlers.free_obj = php_driver_row_stream_free;
+#endif
+  php_driver_row_stream_handlers.get_properties = php_driver_row_stream_properties;
+#if PHP_VERSION_ID < 80000
+  php_driver_row_stream_handlers.compare_objects = php_driver_row_stream_compare;
+#endif
+  php_driver_row_stream_handlers.clone_obj = NULL;
+}
@@ -0,0 +1,23 @@
+/**
+ * Copyright 2015-2017 DataStax, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PHP_DRIVER_ROW_STREAM_H
+#define PHP_DRIVER_ROW_STREAM_H
+
+void
+php_driver_row_stream_init(zval *stream, zval *rows, int prefetch, zval *timeout TSRMLS_DC);
+
+#endif /* PHP_DRIVER_ROW_STREAM_H */
@@ -21,6 +21,9 @@
 #include "util/result.h"
 
 #include "FutureRows.h"
+#include "Row.h"
+#include "RowStream.h"
+#include "Rows.h"
 
 zend_class_entry *php_driver_rows_ce = NULL;
 
@@ -30,13 +33,119 @@ free_result(void *result)
   cass_result_free((CassResult *) result);
 }
 
+static void
+free_cursor(void *cursor)
+{
+  TSRMLS_FETCH();
+  php_driver_result_cursor_free((php_driver_result_cursor *) cursor TSRMLS_CC);
+}
+
+int
+php_driver_rows_init_lazy(php_driver_rows *rows, php_driver_ref *result TSRMLS_DC)
+{
+  php_driver_result_cursor *cursor;
+
+  /* In lazy mode the rows array only caches the rows decoded so far */
+  PHP5TO7_ZVAL_MAYBE_MAKE(rows->rows);
+  array_init(PHP5TO7_ZVAL_MAYBE_P(rows->rows));
+  rows->position = 0;
+
+  cursor = php_driver_result_cursor_new(result, &rows->options TSRMLS_CC);
+  if (!cursor) {
+    return FAILURE;
+  }
+
+  rows->cursor = php_driver_new_ref(cursor, free_cursor);
+  return SUCCESS;
+}
+
+static int
+php_driver_rows_get(php_driver_rows *self, size_t index, zval *return_value TSRMLS_DC)
+{
+  php5to7_zval *entry;
+  php5to7_zval row;
+  const CassRow *cass_row;
+  php_driver_result_cursor *cursor = (php_driver_result_cursor *) self->cursor->data;
+
+  if (PHP5TO7_ZEND_HASH_INDEX_FIND(PHP5TO7_Z_ARRVAL_MAYBE_P(self->rows), index, entry)) {
+    RETVAL_ZVAL(PHP5TO7_ZVAL_MAYBE_DEREF(entry), 1, 0);
+    return SUCCESS;
+  }
+
+  if (self->options.row_objects > 0) {
+    /* Row objects decode their cells on access, only the position is kept */
+    if (index >= cursor->count) {
+      return FAILURE;
+    }
+    PHP5TO7_ZVAL_MAYBE_MAKE(row);
+    php_driver_row_init(PHP5TO7_ZVAL_MAYBE_P(row), self->cursor, index TSRMLS_CC);
+  } else {
+    cass_row = php_driver_result_cursor_seek(cursor, index);
+    if (cass_row == NULL ||
+        php_driver_result_plan_decode_row(cursor->plan, cass_row, &row TSRMLS_CC) == FAILURE) {
+      return FAILURE;
+    }
+  }
+
+  PHP5TO7_ZEND_HASH_INDEX_UPDATE(PHP5TO7_Z_ARRVAL_MAYBE_P(self->rows), index,
+                                 PHP5TO7_ZVAL_MAYBE_P(row), sizeof(php5to7_zval));
+  RETVAL_ZVAL(PHP5TO7_ZVAL_MAYBE_P(row), 1, 0);
+  return SUCCESS;
+}
+
+size_t
+php_driver_rows_count(php_driver_rows *self)
+{
+  if (self->cursor) {
+    return ((php_driver_result_cursor *) self->cursor->data)->count;
+  }
+
+  return zend_hash_num_elements(PHP5TO7_Z_ARRVAL_MAYBE_P(self->rows));
+}
+
+int
+php_driver_rows_at(php_driver_rows *self, size_t index, zval *return_value TSRMLS_DC)
+{
+  php5to7_zval *entry;
+
+  if (self->cursor) {
+    return php_driver_rows_get(self, index, return_value TSRMLS_CC);
+  }
+
+  if (PHP5TO7_ZEND_HASH_INDEX_FIND(PHP5TO7_Z_ARRVAL_MAYBE_P(self->rows), index, entry)) {
+    RETVAL_ZVAL(PHP5TO7_ZVAL_MAYBE_DEREF(entry), 1, 0);
+    return SUCCESS;
+  }
+
+  return FAILURE;
+}
+
 static void
 php_driver_rows_create(php_driver_rows *current, zval *result TSRMLS_DC) {
   php_driver_rows *rows;
 
+  if (current->cursor) {
+    object_init_ex(result, php_driver_rows_ce);
+    rows = PHP_DRIVER_GET_ROWS(result);
+    php_driver_result_options_merge(&rows->options, &current->options);
+
+    if (php_driver_rows_init_lazy(rows, current->next_result TSRMLS_CC) == FAILURE) {
+      return;
+    }
+
+    if (cass_result_has_more_pages((const CassResult *) current->next_result->data)) {
+      rows->statement = php_driver_add_ref(current->statement);
+      rows->session   = php_driver_add_ref(current->session);
+      rows->result    = php_driver_add_ref(current->next_result);
+      rows->deadline  = current->deadline;
+    }
+    return;
+  }
+
   if (PHP5TO7_ZVAL_IS_UNDEF(current->next_rows)) {
     if (php_driver_get_result((const CassResult *) current->next_result->data,
-                                 &current->next_rows TSRMLS_CC) == FAILURE) {
+                              &current->options,
+                              &current->next_rows TSRMLS_CC) == FAILURE) {
       PHP5TO7_ZVAL_MAYBE_DESTROY(current->next_rows);
       return;
     }
@@ -44,6 +153,7 @@ php_driver_rows_create(php_driver_rows *current, zval *result TSRMLS_DC) {
 
   object_init_ex(result, php_driver_rows_ce);
   rows = PHP_DRIVER_GET_ROWS(result);
+  php_driver_result_options_merge(&rows->options, &current->options);
 
   PHP5TO7_ZVAL_COPY(PHP5TO7_ZVAL_MAYBE_P(rows->rows),
                     PHP5TO7_ZVAL_MAYBE_P(current->next_rows));
@@ -52,6 +162,7 @@ php_driver_rows_create(php_driver_rows *current, zval *result TSRMLS_DC) {
     rows->statement = php_driver_add_ref(current->statement);
     rows->session   = php_driver_add_ref(current->session);
     rows->result    = php_driver_add_ref(current->next_result);
+    rows->deadline  = current->deadline;
   }
 }
 
@@ -73,7 +184,7 @@ PHP_METHOD(Rows, count)
 
   self = PHP_DRIVER_GET_ROWS(getThis());
 
-  RETURN_LONG(zend_hash_num_elements(Z_ARRVAL_P(PHP5TO7_ZVAL_MAYBE_P(self->rows))));
+  RETURN_LONG(php_driver_rows_count(self));
 }
 
 PHP_METHOD(Rows, rewind)
@@ -85,6 +196,11 @@ PHP_METHOD(Rows, rewind)
 
   self = PHP_DRIVER_GET_ROWS(getThis());
 
+  if (self->cursor) {
+    self->position = 0;
+    return;
+  }
+
   zend_hash_internal_pointer_reset(Z_ARRVAL_P(PHP5TO7_ZVAL_MAYBE_P(self->rows)));
 }
 
@@ -99,6 +215,11 @@ PHP_METHOD(Rows, current)
 
   self = PHP_DRIVER_GET_ROWS(getThis());
 
+  if (self->cursor) {
+    php_driver_rows_get(self, self->position, return_value TSRMLS_CC);
+    return;
+  }
+
   if (PHP5TO7_ZEND_HASH_GET_CURRENT_DATA(PHP5TO7_Z_ARRVAL_MAYBE_P(self->rows), entry)) {
     RETURN_ZVAL(PHP5TO7_ZVAL_MAYBE_DEREF(entry), 1, 0);
   }
@@ -115,9 +236,24 @@ PHP_METHOD(Rows, key)
 
   self = PHP_DRIVER_GET_ROWS(getThis());
 
-  if (PHP5TO7_ZEND_HASH_GET_CURRENT_KEY(PHP5TO7_Z_ARRVAL_MAYBE_P(self->rows),
-                                        &str_index, &num_index) == HASH_KEY_IS_LONG)
+  if (self->cursor) {
+    if (self->position < php_driver_rows_count(self))
+      RETURN_LONG(self->position);
+    return;
+  }
+
+  switch (PHP5TO7_ZEND_HASH_GET_CURRENT_KEY(PHP5TO7_Z_ARRVAL_MAYBE_P(self->rows),
+                                            &str_index, &num_index)) {
+  case HASH_KEY_IS_LONG:
     RETURN_LONG(num_index);
+  case HASH_KEY_IS_STRING:
+    /* Pages fetched with a keyed fetch style are indexed by column values */
+#if PHP_MAJOR_VERSION >= 7
+    RETURN_STR_COPY(str_index);
+#else
+    PHP5TO7_RETURN_STRING(str_index);
+#endif
+  }
 }
 
 PHP_METHOD(Rows, next)
@@ -130,6 +266,11 @@ PHP_METHOD(Rows, next)
 
   self = PHP_DRIVER_GET_ROWS(getThis());
 
+  if (self->cursor) {
+    self->position++;
+    return;
+  }
+
   zend_hash_move_forward(PHP5TO7_Z_ARRVAL_MAYBE_P(self->rows));
 }
 
@@ -142,6 +283,10 @@ PHP_METHOD(Rows, valid)
 
   self = PHP_DRIVER_GET_ROWS(getThis());
 
+  if (self->cursor) {
+    RETURN_BOOL(self->position < php_driver_rows_count(self));
+  }
+
   RETURN_BOOL(zend_hash_has_more_elements(PHP5TO7_Z_ARRVAL_MAYBE_P(self->rows)) == SUCCESS);
 }
 
@@ -153,11 +298,24 @@ PHP_METHOD(Rows, offsetExists)
   if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z", &offset) == FAILURE)
     return;
 
+  self = PHP_DRIVER_GET_ROWS(getThis());
+
+  if (Z_TYPE_P(offset) == IS_STRING && !self->cursor) {
+#if PHP_MAJOR_VERSION >= 7
+    RETURN_BOOL(zend_symtable_exists(Z_ARRVAL(self->rows), Z_STR_P(offset)));
+#else
+    RETURN_BOOL(zend_symtable_exists(Z_ARRVAL_P(self->rows),
+                                     Z_STRVAL_P(offset), Z_STRLEN_P(offset) + 1));
+#endif
+  }
+
   if (Z_TYPE_P(offset) != IS_LONG || Z_LVAL_P(offset) < 0) {
     INVALID_ARGUMENT(offset, "a positive integer");
   }
 
-  self = PHP_DRIVER_GET_ROWS(getThis());
+  if (self->cursor) {
+    RETURN_BOOL((size_t) Z_LVAL_P(offset) < php_driver_rows_count(self));
+  }
 
   RETURN_BOOL(zend_hash_index_exists(PHP5TO7_Z_ARRVAL_MAYBE_P(self->rows),
                                      (php5to7_ulong) Z_LVAL_P(offset)));
@@ -172,11 +330,32 @@ PHP_METHOD(Rows, offsetGet)
   if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z", &offset) == FAILURE)
     return;
 
+  self = PHP_DRIVER_GET_ROWS(getThis());
+
+  if (Z_TYPE_P(offset) == IS_STRING && !self->cursor) {
+#if PHP_MAJOR_VERSION >= 7
+    value = zend_symtable_find(Z_ARRVAL(self->rows), Z_STR_P(offset));
+    if (value) {
+      RETURN_ZVAL(value, 1, 0);
+    }
+#else
+    if (zend_symtable_find(Z_ARRVAL_P(self->rows), Z_STRVAL_P(offset), Z_STRLEN_P(offset) + 1,
+                           (void **) &value) == SUCCESS) {
+      RETURN_ZVAL(*value, 1, 0);
+    }
+#endif
+    return;
+  }
+
   if (Z_TYPE_P(offset) != IS_LONG || Z_LVAL_P(offset) < 0) {
     INVALID_ARGUMENT(offset, "a positive integer");
   }
 
-  self = PHP_DRIVER_GET_ROWS(getThis());
+  if (self->cursor) {
+    php_driver_rows_get(self, (size_t) Z_LVAL_P(offset), return_value TSRMLS_CC);
+    return;
+  }
+
   if (PHP5TO7_ZEND_HASH_INDEX_FIND(PHP5TO7_Z_ARRVAL_MAYBE_P(self->rows), Z_LVAL_P(offset), value)) {
     RETURN_ZVAL(PHP5TO7_ZVAL_MAYBE_DEREF(value), 1, 0);
   }
@@ -222,15 +401,27 @@ PHP_METHOD(Rows, isLastPage)
   RETURN_FALSE;
 }
 
-PHP_METHOD(Rows, nextPage)
+/* Pages share the deadline of the execution, requests for later pages only
+ * get what's left of it */
+static int
+php_driver_rows_set_deadline(php_driver_rows *self TSRMLS_DC)
 {
-  zval *timeout = NULL;
-  php_driver_rows *self = PHP_DRIVER_GET_ROWS(getThis());
+  if (!self->deadline)
+    return SUCCESS;
 
-  if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "|z", &timeout) == FAILURE) {
-    return;
-  }
+  if (php_driver_future_check_deadline(self->deadline TSRMLS_CC) == FAILURE)
+    return FAILURE;
 
+  ASSERT_SUCCESS_VALUE(cass_statement_set_request_timeout((CassStatement *) self->statement->data,
+                                                          php_driver_future_request_timeout(NULL, self->deadline)),
+                       FAILURE);
+
+  return SUCCESS;
+}
+
+void
+php_driver_rows_next_page(php_driver_rows *self, zval *timeout, zval *return_value TSRMLS_DC)
+{
   if (!self->next_result) {
     if (!PHP5TO7_ZVAL_IS_UNDEF(self->future_next_page)) {
       php_driver_future_rows *future_rows = NULL;
@@ -257,17 +448,19 @@ PHP_METHOD(Rows, nextPage)
         return;
       }
 
+      if (php_driver_rows_set_deadline(self TSRMLS_CC) == FAILURE) {
+        return;
+      }
+
       ASSERT_SUCCESS(cass_statement_set_paging_state((CassStatement *) self->statement->data,
                                                      (const CassResult *) self->result->data));
 
       future = cass_session_execute((CassSession *) self->session->data,
                                     (CassStatement *) self->statement->data);
 
-      if (php_driver_future_wait_timed(future, timeout TSRMLS_CC) == FAILURE) {
-        return;
-      }
-
-      if (php_driver_future_is_error(future TSRMLS_CC) == FAILURE) {
+      if (php_driver_future_wait_deadline(future, timeout, self->deadline TSRMLS_CC) == FAILURE ||
+          php_driver_future_is_error(future TSRMLS_CC) == FAILURE) {
+        php_driver_future_release(future, self->statement TSRMLS_CC);
         return;
       }
 
@@ -291,18 +484,24 @@ PHP_METHOD(Rows, nextPage)
   php_driver_rows_create(self, return_value TSRMLS_CC);
 }
 
-PHP_METHOD(Rows, nextPageAsync)
+PHP_METHOD(Rows, nextPage)
 {
-  php_driver_rows *self = NULL;
-  php_driver_future_rows *future_rows = NULL;
+  zval *timeout = NULL;
 
-  if (zend_parse_parameters_none() == FAILURE)
+  if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "|z", &timeout) == FAILURE) {
     return;
+  }
 
-  self = PHP_DRIVER_GET_ROWS(getThis());
+  php_driver_rows_next_page(PHP_DRIVER_GET_ROWS(getThis()), timeout, return_value TSRMLS_CC);
+}
+
+int
+php_driver_rows_request_next_page(php_driver_rows *self TSRMLS_DC)
+{
+  php_driver_future_rows *future_rows = NULL;
 
   if (!PHP5TO7_ZVAL_IS_UNDEF(self->future_next_page)) {
-    RETURN_ZVAL(PHP5TO7_ZVAL_MAYBE_P(self->future_next_page), 1, 0);
+    return SUCCESS;
   }
 
   if (self->next_result) {
@@ -312,16 +511,20 @@ PHP_METHOD(Rows, nextPageAsync)
     future_value = PHP_DRIVER_GET_FUTURE_VALUE(PHP5TO7_ZVAL_MAYBE_P(self->future_next_page));
     PHP5TO7_ZVAL_MAYBE_MAKE(future_value->value);
     php_driver_rows_create(self, PHP5TO7_ZVAL_MAYBE_P(future_value->value) TSRMLS_CC);
-    RETURN_ZVAL(PHP5TO7_ZVAL_MAYBE_P(self->future_next_page), 1, 0);
+    return SUCCESS;
   }
 
   if (self->result == NULL) {
-    object_init_ex(return_value, php_driver_future_value_ce);
-    return;
+    return FAILURE;
+  }
+
+  if (php_driver_rows_set_deadline(self TSRMLS_CC) == FAILURE) {
+    return FAILURE;
   }
 
-  ASSERT_SUCCESS(cass_statement_set_paging_state((CassStatement *) self->statement->data,
-                                                 (const CassResult *) self->result->data));
+  ASSERT_SUCCESS_VALUE(cass_statement_set_paging_state((CassStatement *) self->statement->data,
+                                                       (const CassResult *) self->result->data),
+                       FAILURE);
 
   PHP5TO7_ZVAL_MAYBE_MAKE(self->future_next_page);
   object_init_ex(PHP5TO7_ZVAL_MAYBE_P(self->future_next_page), php_driver_future_rows_ce);
@@ -329,12 +532,54 @@ PHP_METHOD(Rows, nextPageAsync)
 
   future_rows->statement = php_driver_add_ref(self->statement);
   future_rows->session = php_driver_add_ref(self->session);
+  future_rows->deadline = self->deadline;
+  php_driver_result_options_merge(&future_rows->options, &self->options);
   future_rows->future    = cass_session_execute((CassSession *) self->session->data,
                                                 (CassStatement *) self->statement->data);
 
+  return SUCCESS;
+}
+
+PHP_METHOD(Rows, nextPageAsync)
+{
+  php_driver_rows *self = NULL;
+
+  if (zend_parse_parameters_none() == FAILURE)
+    return;
+
+  self = PHP_DRIVER_GET_ROWS(getThis());
+
+  if (php_driver_rows_request_next_page(self TSRMLS_CC) == FAILURE) {
+    if (self->result == NULL) {
+      object_init_ex(return_value, php_driver_future_value_ce);
+    }
+    return;
+  }
+
   RETURN_ZVAL(PHP5TO7_ZVAL_MAYBE_P(self->future_next_page), 1, 0);
 }
 
+PHP_METHOD(Rows, stream)
+{
+  zend_bool prefetch = 1;
+  zval *timeout = NULL;
+  php_driver_rows *self = NULL;
+
+  if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "|bz", &prefetch, &timeout) == FAILURE) {
+    return;
+  }
+
+  self = PHP_DRIVER_GET_ROWS(getThis());
+
+  if (php_driver_result_options_keyed(&self->options)) {
+    zend_throw_exception_ex(php_driver_logic_exception_ce, 0 TSRMLS_CC,
+                            "Rows fetched with a keyed fetch style can't be streamed");
+    return;
+  }
+
+  php_driver_row_stream_init(return_value, getThis(), prefetch, timeout TSRMLS_CC);
+}
+
 PHP_METHOD(Rows, pagingStateToken)
 {
   const char *paging_state;
@@ -355,6 +600,79 @@ PHP_METHOD(Rows, pagingStateToken)
   PHP5TO7_RETURN_STRINGL(paging_state, paging_state_size);
 }
 
+#if PHP_MAJOR_VERSION >= 7
+static void
+php_driver_rows_transpose(zval *rows, zval *return_value)
+{
+  zval *row;
+
+  array_init(return_value);
+
+  ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(rows), row) {
+    zend_string *name;
+    zend_ulong index;
+    zval *value;
+
+    ZVAL_DEREF(row);
+    ZEND_HASH_FOREACH_KEY_VAL(Z_ARRVAL_P(row), index, name, value) {
+      zval *column = name ? zend_hash_find(Z_ARRVAL_P(return_value), name)
+                          : zend_hash_index_find(Z_ARRVAL_P(return_value), index);
+
+      if (!column) {
+        zval values;
+        array_init(&values);
+        column = name ? zend_hash_update(Z_ARRVAL_P(return_value), name, &values)
+                      : zend_hash_index_update(Z_ARRVAL_P(return_value), index, &values);
+      }
+
+      Z_TRY_ADDREF_P(value);
+      add_next_index_zval(column, value);
+    } ZEND_HASH_FOREACH_END();
+  } ZEND_HASH_FOREACH_END();
+}
+#endif
+
+PHP_METHOD(Rows, columns)
+{
+  php_driver_rows* self = NULL;
+
+  if (zend_parse_parameters_none() == FAILURE) {
+    return;
+  }
+
+  self = PHP_DRIVER_GET_ROWS(getThis());
+
+  if (self->options.fetch_style == PHP_DRIVER_FETCH_COLUMN ||
+      php_driver_result_options_keyed(&self->options)) {
+    zend_throw_exception_ex(php_driver_logic_exception_ce, 0 TSRMLS_CC,
+                            "Columns are only available for the FETCH_ASSOC and FETCH_NUM fetch styles");
+    return;
+  }
+
+  if (PHP5TO7_ZVAL_IS_UNDEF(self->columns)) {
+    if (self->cursor) {
+      php_driver_result_cursor *cursor = (php_driver_result_cursor *) self->cursor->data;
+
+      if (php_driver_result_plan_decode_columns(cursor->plan,
+                                                (const CassResult *) cursor->result->data,
+                                                &self->columns TSRMLS_CC) == FAILURE) {
+        PHP5TO7_ZVAL_UNDEF(self->columns);
+        return;
+      }
+    } else {
+#if PHP_MAJOR_VERSION >= 7
+      php_driver_rows_transpose(&self->rows, &self->columns);
+#else
+      zend_throw_exception_ex(php_driver_logic_exception_ce, 0 TSRMLS_CC,
+                              "Columns require the columnar execution option");
+      return;
+#endif
+    }
+  }
+
+  RETURN_ZVAL(PHP5TO7_ZVAL_MAYBE_P(self->columns), 1, 0);
+}
+
 PHP_METHOD(Rows, first)
 {
   HashPosition pos;
@@ -367,6 +685,11 @@ PHP_METHOD(Rows, first)
 
   self = PHP_DRIVER_GET_ROWS(getThis());
 
+  if (self->cursor) {
+    php_driver_rows_get(self, 0, return_value TSRMLS_CC);
+    return;
+  }
+
   zend_hash_internal_pointer_reset_ex(PHP5TO7_Z_ARRVAL_MAYBE_P(self->rows), &pos);
   if (PHP5TO7_ZEND_HASH_GET_CURRENT_DATA(PHP5TO7_Z_ARRVAL_MAYBE_P(self->rows), entry)) {
     RETVAL_ZVAL(PHP5TO7_ZVAL_MAYBE_DEREF(entry), 1, 0);
@@ -391,7 +714,10 @@ ZEND_END_ARG_INFO()
 ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_mixed, 0, 0, IS_MIXED, 0)
 ZEND_END_ARG_INFO()
 
-ZEND_BEGIN_ARG_WITH_RETURN_TYPE_MASK_EX(arginfo_key_maybe_long, 0, 0, MAY_BE_LONG|MAY_BE_NULL)
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_array, 0, 0, IS_ARRAY, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_MASK_EX(arginfo_key, 0, 0, MAY_BE_LONG|MAY_BE_STRING|MAY_BE_NULL)
 ZEND_END_ARG_INFO()
 
 ZEND_BEGIN_ARG_WITH_RETURN_TYPE_MASK_EX(arginfo_string_or_null, 0, 0, MAY_BE_STRING|MAY_BE_NULL)
@@ -404,6 +730,11 @@ ZEND_END_ARG_INFO()
 ZEND_BEGIN_ARG_WITH_RETURN_TYPE_MASK_EX(arginfo_next_page_async, 0, 0, MAY_BE_OBJECT)
 ZEND_END_ARG_INFO()
 
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_stream, 0, 0, IS_OBJECT, 0)
+  ZEND_ARG_TYPE_INFO_WITH_DEFAULT_VALUE(0, prefetch, _IS_BOOL, 0, "true")
+  ZEND_ARG_TYPE_INFO_WITH_DEFAULT_VALUE(0, timeout, IS_MIXED, 1, "null")
+ZEND_END_ARG_INFO()
+
 ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_offset_exists, 0, 1, _IS_BOOL, 0)
   ZEND_ARG_INFO(0, offset)
 ZEND_END_ARG_INFO()
@@ -437,6 +768,11 @@ ZEND_END_ARG_INFO()
 ZEND_BEGIN_ARG_INFO_EX(arginfo_timeout, 0, ZEND_RETURN_VALUE, 1)
   ZEND_ARG_INFO(0, timeout)
 ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_stream, 0, ZEND_RETURN_VALUE, 0)
+  ZEND_ARG_INFO(0, prefetch)
+  ZEND_ARG_INFO(0, timeout)
+ZEND_END_ARG_INFO()
 #endif
 
 static zend_function_entry php_driver_rows_methods[] = {
@@ -445,7 +781,7 @@ static zend_function_entry php_driver_rows_methods[] = {
   PHP_ME(Rows, count,            arginfo_count,         ZEND_ACC_PUBLIC)
   PHP_ME(Rows, rewind,           arginfo_none,          ZEND_ACC_PUBLIC)
   PHP_ME(Rows, current,          arginfo_mixed,         ZEND_ACC_PUBLIC)
-  PHP_ME(Rows, key,              arginfo_key_maybe_long,ZEND_ACC_PUBLIC)
+  PHP_ME(Rows, key,              arginfo_key,           ZEND_ACC_PUBLIC)
   PHP_ME(Rows, next,             arginfo_none,          ZEND_ACC_PUBLIC)
   PHP_ME(Rows, valid,            arginfo_bool,          ZEND_ACC_PUBLIC)
   PHP_ME(Rows, offsetExists,     arginfo_offset_exists, ZEND_ACC_PUBLIC)
@@ -455,8 +791,10 @@ static zend_function_entry php_driver_rows_methods[] = {
   PHP_ME(Rows, isLastPage,       arginfo_bool,          ZEND_ACC_PUBLIC)
   PHP_ME(Rows, nextPage,         arginfo_rows_next_page,ZEND_ACC_PUBLIC)
   PHP_ME(Rows, nextPageAsync,    arginfo_next_page_async,ZEND_ACC_PUBLIC)
+  PHP_ME(Rows, stream,           arginfo_stream,        ZEND_ACC_PUBLIC)
   PHP_ME(Rows, pagingStateToken, arginfo_string_or_null,ZEND_ACC_PUBLIC)
   PHP_ME(Rows, first,            arginfo_mixed,         ZEND_ACC_PUBLIC)
+  PHP_ME(Rows, columns,          arginfo_array,         ZEND_ACC_PUBLIC)
 #else
   PHP_ME(Rows, __construct,      arginfo_none,    ZEND_ACC_PUBLIC | ZEND_ACC_CTOR)
   PHP_ME(Rows, count,            arginfo_none,    ZEND_ACC_PUBLIC)
@@ -472,8 +810,10 @@ static zend_function_entry php_driver_rows_methods[] = {
   PHP_ME(Rows, isLastPage,       arginfo_none,    ZEND_ACC_PUBLIC)
   PHP_ME(Rows, nextPage,         arginfo_timeout, ZEND_ACC_PUBLIC)
   PHP_ME(Rows, nextPageAsync,    arginfo_none,    ZEND_ACC_PUBLIC)
+  PHP_ME(Rows, stream,           arginfo_stream,  ZEND_ACC_PUBLIC)
   PHP_ME(Rows, pagingStateToken, arginfo_none,    ZEND_ACC_PUBLIC)
   PHP_ME(Rows, first,            arginfo_none,    ZEND_ACC_PUBLIC)
+  PHP_ME(Rows, columns,          arginfo_none,    ZEND_ACC_PUBLIC)
 #endif
   PHP_FE_END
 };
@@ -508,6 +848,7 @@ php_driver_rows_free(php5to7_zend_object_free *object TSRMLS_DC)
 {
   php_driver_rows *self = PHP5TO7_ZEND_OBJECT_GET(rows, object);
 
+  php_driver_del_ref(&self->cursor);
   php_driver_del_ref(&self->result);
   php_driver_del_ref(&self->statement);
   php_driver_del_peref(&self->session, 1);
@@ -516,6 +857,8 @@ php_driver_rows_free(php5to7_zend_object_free *object TSRMLS_DC)
   PHP5TO7_ZVAL_MAYBE_DESTROY(self->rows);
   PHP5TO7_ZVAL_MAYBE_DESTROY(self->next_rows);
   PHP5TO7_ZVAL_MAYBE_DESTROY(self->future_next_page);
+  PHP5TO7_ZVAL_MAYBE_DESTROY(self->columns);
+  php_driver_result_options_destroy(&self->options);
 
 #if PHP_VERSION_ID >= 80000
   zend_object_std_dtor(&self->std);
@@ -535,9 +878,14 @@ php_driver_rows_new(zend_class_entry *ce TSRMLS_DC)
   self->session     = NULL;
   self->result      = NULL;
   self->next_result = NULL;
+  self->cursor      = NULL;
+  self->position    = 0;
+  self->deadline    = 0;
+  php_driver_result_options_init(&self->options);
   PHP5TO7_ZVAL_UNDEF(self->rows);
   PHP5TO7_ZVAL_UNDEF(self->next_rows);
   PHP5TO7_ZVAL_UNDEF(self->future_next_page);
+  PHP5TO7_ZVAL_UNDEF(self->columns);
 
   PHP5TO7_ZEND_OBJECT_INIT(rows, self, ce);
 }
@@ -553,6 +901,10 @@ void php_driver_define_Rows(TSRMLS_D)
   php_driver_rows_ce->create_object = php_driver_rows_new;
 
   memcpy(&php_driver_rows_handlers, zend_get_std_object_handlers(), sizeof(zend_object_handlers));
+#if PHP_VERSION_ID >= 80000
+  php_driver_rows_handlers.offset   = XtOffsetOf(php_driver_rows, std);
+  php_driver_rows_handlers.free_obj = php_driver_rows_free;
+#endif
   php_driver_rows_handlers.get_properties = php_driver_rows_properties;
   /* compare_objects was removed in PHP 8 */
 #if PHP_VERSION_ID < 80000
@@ -0,0 +1,37 @@
+/**
+ * Copyright 2015-2017 DataStax, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PHP_DRIVER_ROWS_H
+#define PHP_DRIVER_ROWS_H
+
+int
+php_driver_rows_init_lazy(php_driver_rows *rows, php_driver_ref *result TSRMLS_DC);
+
+size_t
+php_driver_rows_count(php_driver_rows *rows);
+
+int
+php_driver_rows_at(php_driver_rows *rows, size_t index, zval *return_value TSRMLS_DC);
+
+/* Starts fetching the next page unless it's already requested or fetched,
+ * fails when this is the last page */
+int
+php_driver_rows_request_next_page(php_driver_rows *rows TSRMLS_DC);
+
+void
+php_driver_rows_next_page(php_driver_rows *rows, zval *timeout, zval *return_value TSRMLS_DC);
+
+#endif /* PHP_DRIVER_ROWS_H */
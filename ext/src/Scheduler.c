@@ -0,0 +1,294 @@
+/**
+ * Copyright 2017 DataStax, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "php_driver.h"
+#include "php_driver_globals.h"
+#include "php_driver_types.h"
+#include "util/future.h"
+
+#include "Scheduler.h"
+
+#include <uv.h>
+
+#if PHP_VERSION_ID >= 80100
+#include "zend_fibers.h"
+#include "zend_interfaces.h"
+#endif
+
+zend_class_entry *php_driver_scheduler_ce = NULL;
+
+#if PHP_VERSION_ID >= 80100
+/* A fiber suspended until its future completes, keyed by the fiber's handle
+ * in the request's scheduler */
+typedef struct {
+  zval fiber;
+  zval future;
+  uint64_t deadline;
+} awaiting_fiber;
+
+static void
+awaiting_fiber_free(zval *zv)
+{
+  awaiting_fiber *awaiting = (awaiting_fiber *) Z_PTR_P(zv);
+
+  zval_ptr_dtor(&awaiting->fiber);
+  zval_ptr_dtor(&awaiting->future);
+  efree(awaiting);
+}
+
+static HashTable *
+awaiting_fibers()
+{
+  if (!PHP_DRIVER_G(awaiting_fibers)) {
+    ALLOC_HASHTABLE(PHP_DRIVER_G(awaiting_fibers));
+    zend_hash_init(PHP_DRIVER_G(awaiting_fibers), 0, NULL, awaiting_fiber_free, 0);
+  }
+
+  return PHP_DRIVER_G(awaiting_fibers);
+}
+
+static int
+awaiting_fiber_ready(awaiting_fiber *awaiting, uint64_t now)
+{
+  CassFuture *future = php_driver_future_get(&awaiting->future);
+
+  return !future || cass_future_ready(future) ||
+         (awaiting->deadline && now >= awaiting->deadline);
+}
+
+/* Resumes the fibers whose futures completed or timed out, returns how many
+ * were resumed or -1 when one of them throws */
+static int
+resume_fibers(uint64_t *next_deadline TSRMLS_DC)
+{
+  HashTable *fibers = PHP_DRIVER_G(awaiting_fibers);
+  awaiting_fiber *awaiting;
+  uint64_t now = uv_hrtime();
+  zval ready;
+  zval *fiber;
+  int resumed = 0;
+
+  if (next_deadline)
+    *next_deadline = 0;
+
+  if (!fibers || zend_hash_num_elements(fibers) == 0)
+    return 0;
+
+  /* Resumed fibers may await other futures, collect them first */
+  array_init(&ready);
+  ZEND_HASH_FOREACH_PTR(fibers, awaiting) {
+    if (awaiting_fiber_ready(awaiting, now)) {
+      Z_ADDREF(awaiting->fiber);
+      add_next_index_zval(&ready, &awaiting->fiber);
+    } else if (next_deadline && awaiting->deadline &&
+               (!*next_deadline || awaiting->deadline < *next_deadline)) {
+      *next_deadline = awaiting->deadline;
+    }
+  } ZEND_HASH_FOREACH_END();
+
+  ZEND_HASH_FOREACH_VAL(Z_ARRVAL(ready), fiber) {
+    zval retval;
+
+    /* Another fiber may have resumed it already */
+    if (!PHP_DRIVER_G(awaiting_fibers) ||
+        !zend_hash_index_exists(PHP_DRIVER_G(awaiting_fibers), Z_OBJ_HANDLE_P(fiber)))
+      continue;
+
+    ZVAL_UNDEF(&retval);
+    zend_call_method_with_0_params(Z_OBJ_P(fiber), zend_ce_fiber, NULL, "resume", &retval);
+    zval_ptr_dtor(&retval);
+
+    if (EG(exception)) {
+      resumed = -1;
+      break;
+    }
+    resumed++;
+  } ZEND_HASH_FOREACH_END();
+
+  zval_ptr_dtor(&ready);
+
+  return resumed;
+}
+#endif
+
+int
+php_driver_scheduler_await(zval *future, zval *timeout TSRMLS_DC)
+{
+#if PHP_VERSION_ID >= 80100
+  zend_fiber *fiber = EG(active_fiber);
+  CassFuture *cass_future = php_driver_future_get(future);
+  cass_duration_t timeout_us;
+  awaiting_fiber *awaiting;
+  uint64_t deadline;
+  zend_ulong handle;
+  int rc = SUCCESS;
+
+  if (!fiber || !cass_future || cass_future_ready(cass_future))
+    return SUCCESS;
+
+  if (php_driver_future_timeout(timeout, &timeout_us TSRMLS_CC) == FAILURE)
+    return FAILURE;
+
+  awaiting = (awaiting_fiber *) emalloc(sizeof(awaiting_fiber));
+  ZVAL_OBJ_COPY(&awaiting->fiber, &fiber->std);
+  ZVAL_COPY(&awaiting->future, future);
+  awaiting->deadline = deadline = timeout_us ? uv_hrtime() + (uint64_t) timeout_us * 1000 : 0;
+
+  handle = fiber->std.handle;
+  zend_hash_index_update_ptr(awaiting_fibers(), handle, awaiting);
+
+  php_driver_future_watch(cass_future);
+
+  /* Fibers can be resumed by others than the scheduler, suspend until the
+   * future is actually done */
+  while (1) {
+    zval retval;
+
+    ZVAL_UNDEF(&retval);
+    zend_call_method_with_0_params(NULL, zend_ce_fiber, NULL, "suspend", &retval);
+    zval_ptr_dtor(&retval);
+
+    if (EG(exception)) {
+      rc = FAILURE;
+      break;
+    }
+
+    cass_future = php_driver_future_get(future);
+    if (!cass_future || cass_future_ready(cass_future))
+      break;
+
+    if (deadline && uv_hrtime() >= deadline) {
+      zend_throw_exception_ex(php_driver_timeout_exception_ce, 0 TSRMLS_CC,
+                              "Future hasn't resolved within %f seconds", timeout_us / 1000000.0);
+      rc = FAILURE;
+      break;
+    }
+  }
+
+  if (PHP_DRIVER_G(awaiting_fibers))
+    zend_hash_index_del(PHP_DRIVER_G(awaiting_fibers), handle);
+
+  return rc;
+#else
+  return SUCCESS;
+#endif
+}
+
+void
+php_driver_scheduler_destroy(TSRMLS_D)
+{
+  if (PHP_DRIVER_G(awaiting_fibers)) {
+    HashTable *fibers = PHP_DRIVER_G(awaiting_fibers);
+
+    PHP_DRIVER_G(awaiting_fibers) = NULL;
+    zend_hash_destroy(fibers);
+    FREE_HASHTABLE(fibers);
+  }
+}
+
+PHP_METHOD(Scheduler, __construct)
+{
+}
+
+PHP_METHOD(Scheduler, tick)
+{
+  int resumed = 0;
+
+  if (zend_parse_parameters_none() == FAILURE) {
+    return;
+  }
+
+#if PHP_VERSION_ID >= 80100
+  resumed = resume_fibers(NULL TSRMLS_CC);
+  if (resumed < 0)
+    return;
+#endif
+
+  RETURN_LONG(resumed);
+}
+
+PHP_METHOD(Scheduler, run)
+{
+  zval *timeout = NULL;
+#if PHP_VERSION_ID >= 80100
+  cass_duration_t timeout_us;
+  uint64_t deadline = 0;
+#endif
+
+  if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "|z", &timeout) == FAILURE) {
+    return;
+  }
+
+#if PHP_VERSION_ID >= 80100
+  if (php_driver_future_timeout(timeout, &timeout_us TSRMLS_CC) == FAILURE)
+    return;
+
+  if (timeout_us)
+    deadline = uv_hrtime() + (uint64_t) timeout_us * 1000;
+
+  while (PHP_DRIVER_G(awaiting_fibers) &&
+         zend_hash_num_elements(PHP_DRIVER_G(awaiting_fibers)) > 0) {
+    unsigned long completions = php_driver_future_completions();
+    uint64_t next_deadline;
+    int resumed = resume_fibers(&next_deadline TSRMLS_CC);
+
+    if (resumed < 0)
+      return;
+    if (resumed > 0)
+      continue;
+
+    if (deadline) {
+      if (uv_hrtime() >= deadline)
+        RETURN_FALSE;
+      if (!next_deadline || deadline < next_deadline)
+        next_deadline = deadline;
+    }
+
+    php_driver_future_wait_completion(completions, next_deadline);
+  }
+#endif
+
+  RETURN_TRUE;
+}
+
+#if PHP_VERSION_ID >= 80100
+/* Constructors cannot declare a return type; use untyped arginfo */
+ZEND_BEGIN_ARG_INFO_EX(arginfo_none, 0, 0, 0)
+ZEND_END_ARG_INFO()
+#else
+ZEND_BEGIN_ARG_INFO_EX(arginfo_none, 0, ZEND_RETURN_VALUE, 0)
+ZEND_END_ARG_INFO()
+#endif
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_timeout, 0, ZEND_RETURN_VALUE, 0)
+  ZEND_ARG_INFO(0, timeout)
+ZEND_END_ARG_INFO()
+
+static zend_function_entry php_driver_scheduler_methods[] = {
+  PHP_ME(Scheduler, __construct, arginfo_none, ZEND_ACC_PRIVATE | ZEND_ACC_CTOR)
+  PHP_ME(Scheduler, tick, arginfo_none, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+  PHP_ME(Scheduler, run, arginfo_timeout, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+  PHP_FE_END
+};
+
+void php_driver_define_Scheduler(TSRMLS_D)
+{
+  zend_class_entry ce;
+
+  INIT_CLASS_ENTRY(ce, PHP_DRIVER_NAMESPACE "\\Scheduler", php_driver_scheduler_methods);
+  php_driver_scheduler_ce = zend_register_internal_class(&ce TSRMLS_CC);
+  php_driver_scheduler_ce->ce_flags |= PHP5TO7_ZEND_ACC_FINAL;
+}
@@ -0,0 +1,28 @@
+/**
+ * Copyright 2017 DataStax, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PHP_DRIVER_SCHEDULER_H
+#define PHP_DRIVER_SCHEDULER_H
+
+/* Suspends the current fiber until the future completes or the timeout
+ * expires, the scheduler resumes it. Returns right away outside of fibers so
+ * that the caller blocks on the future instead */
+int php_driver_scheduler_await(zval *future, zval *timeout TSRMLS_DC);
+
+/* Releases the fibers still awaiting futures at the end of a request */
+void php_driver_scheduler_destroy(TSRMLS_D);
+
+#endif /* PHP_DRIVER_SCHEDULER_H */
@@ -44,6 +44,7 @@ php_driver_set_add(php_driver_set *set, zval *object)
   HASH_FIND_ZVAL(set->entries, object, entry);
   if (entry == NULL) {
     set->dirty = 1;
+    PHP_DRIVER_CLEAR_ENCODED(set);
     entry = (php_driver_set_entry *) emalloc(sizeof(php_driver_set_entry));
     ZVAL_COPY(&entry->value, object);
     HASH_ADD_ZVAL(set->entries, value, entry);
@@ -68,6 +69,7 @@ php_driver_set_del(php_driver_set *set, zval *object)
   HASH_FIND_ZVAL(set->entries, object, entry);
   if (entry != NULL) {
     set->dirty = 1;
+    PHP_DRIVER_CLEAR_ENCODED(set);
     if (entry == set->iter_temp) {
       set->iter_temp = (php_driver_set_entry *)set->iter_temp->hh.next;
     }
@@ -494,6 +496,7 @@ php_driver_set_free(zend_object *object)
   if (!Z_ISUNDEF(self->type)) {
     zval_ptr_dtor(&self->type);
   }
+  PHP_DRIVER_CLEAR_ENCODED(self);
 
   zend_object_std_dtor(&self->std);
 }
@@ -511,6 +514,7 @@ php_driver_set_free(void *object TSRMLS_DC)
   }
 
   zval_ptr_dtor(&self->type);
+  PHP_DRIVER_CLEAR_ENCODED(self);
 
   zend_object_std_dtor(&self->zval TSRMLS_CC);
   efree(self);
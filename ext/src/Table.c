@@ -16,6 +16,7 @@
 
 #include "php_driver.h"
 
+#include "php_driver_types.h"
 #include "util/result.h"
 
 zend_class_entry *php_driver_table_ce = NULL;
@@ -88,6 +88,12 @@ php_driver_varint_init(INTERNAL_FUNCTION_PARAMETERS)
     self = PHP_DRIVER_GET_NUMERIC(return_value);
   }
 
+  /* The value changes when the constructor is called again */
+  if (self->data.varint.encoded) {
+    free(self->data.varint.encoded);
+    self->data.varint.encoded = NULL;
+  }
+
   if (Z_TYPE_P(num) == IS_LONG) {
     mpz_set_si(self->data.varint.value, Z_LVAL_P(num));
   } else if (Z_TYPE_P(num) == IS_DOUBLE) {
@@ -485,13 +491,22 @@ php_driver_varint_cast(zval *object, zval *retval, int type TSRMLS_DC)
   return SUCCESS;
 }
 
-#if PHP_VERSION_ID < 80000
+#if PHP_VERSION_ID >= 80000
+static void php_driver_varint_free_obj(zend_object *object)
+{
+  php_driver_numeric *self = php_driver_numeric_object_fetch(object);
+  mpz_clear(self->data.varint.value);
+  free(self->data.varint.encoded);
+  zend_object_std_dtor(object);
+}
+#else
 static void
 php_driver_varint_free(php5to7_zend_object_free *object TSRMLS_DC)
 {
   php_driver_numeric *self = PHP5TO7_ZEND_OBJECT_GET(numeric, object);
 
   mpz_clear(self->data.varint.value);
+  free(self->data.varint.encoded);
 
   #if PHP_VERSION_ID >= 80000
   zend_object_std_dtor(&self->std);
@@ -542,6 +557,9 @@ void php_driver_define_Varint(TSRMLS_D)
   php_driver_varint_handlers.std.compare_objects = php_driver_varint_compare;
 #endif
   php_driver_varint_handlers.std.cast_object = php_driver_varint_cast;
+#if PHP_VERSION_ID >= 80000
+  php_driver_varint_handlers.std.free_obj = php_driver_varint_free_obj;
+#endif
 
   php_driver_varint_handlers.hash_value = php_driver_varint_hash_value;
   php_driver_varint_handlers.std.clone_obj = NULL;
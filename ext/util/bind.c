@@ -0,0 +1,948 @@
+/**
+ * Copyright 2015-2017 DataStax, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "php_driver.h"
+#include "php_driver_types.h"
+#include "bind.h"
+#include "collections.h"
+#include "math.h"
+
+#define CHECK_RESULT(rc) \
+{ \
+  ASSERT_SUCCESS_VALUE(rc, FAILURE) \
+  return SUCCESS; \
+}
+
+typedef enum {
+  PHP_DRIVER_BIND_UNKNOWN = 0,
+  PHP_DRIVER_BIND_FLOAT,
+  PHP_DRIVER_BIND_BIGINT,
+  PHP_DRIVER_BIND_SMALLINT,
+  PHP_DRIVER_BIND_TINYINT,
+  PHP_DRIVER_BIND_TIMESTAMP,
+  PHP_DRIVER_BIND_DATE,
+  PHP_DRIVER_BIND_TIME,
+  PHP_DRIVER_BIND_BLOB,
+  PHP_DRIVER_BIND_VARINT,
+  PHP_DRIVER_BIND_DECIMAL,
+  PHP_DRIVER_BIND_UUID,
+  PHP_DRIVER_BIND_INET,
+  PHP_DRIVER_BIND_DURATION,
+  PHP_DRIVER_BIND_SET,
+  PHP_DRIVER_BIND_MAP,
+  PHP_DRIVER_BIND_COLLECTION,
+  PHP_DRIVER_BIND_TUPLE,
+  PHP_DRIVER_BIND_USER_TYPE_VALUE
+} php_driver_bind_kind;
+
+/* The classes of the values that can be bound, in the order they are tested
+ * for values whose class isn't one of them, such as user subclasses */
+static const struct {
+  zend_class_entry **ce;
+  php_driver_bind_kind kind;
+} bind_classes[] = {
+  { &php_driver_float_ce,            PHP_DRIVER_BIND_FLOAT },
+  { &php_driver_bigint_ce,           PHP_DRIVER_BIND_BIGINT },
+  { &php_driver_smallint_ce,         PHP_DRIVER_BIND_SMALLINT },
+  { &php_driver_tinyint_ce,          PHP_DRIVER_BIND_TINYINT },
+  { &php_driver_timestamp_ce,        PHP_DRIVER_BIND_TIMESTAMP },
+  { &php_driver_date_ce,             PHP_DRIVER_BIND_DATE },
+  { &php_driver_time_ce,             PHP_DRIVER_BIND_TIME },
+  { &php_driver_blob_ce,             PHP_DRIVER_BIND_BLOB },
+  { &php_driver_varint_ce,           PHP_DRIVER_BIND_VARINT },
+  { &php_driver_decimal_ce,          PHP_DRIVER_BIND_DECIMAL },
+  { &php_driver_uuid_ce,             PHP_DRIVER_BIND_UUID },
+  { &php_driver_timeuuid_ce,         PHP_DRIVER_BIND_UUID },
+  { &php_driver_uuid_interface_ce,   PHP_DRIVER_BIND_UUID },
+  { &php_driver_inet_ce,             PHP_DRIVER_BIND_INET },
+  { &php_driver_duration_ce,         PHP_DRIVER_BIND_DURATION },
+  { &php_driver_set_ce,              PHP_DRIVER_BIND_SET },
+  { &php_driver_map_ce,              PHP_DRIVER_BIND_MAP },
+  { &php_driver_collection_ce,       PHP_DRIVER_BIND_COLLECTION },
+  { &php_driver_tuple_ce,            PHP_DRIVER_BIND_TUPLE },
+  { &php_driver_user_type_value_ce,  PHP_DRIVER_BIND_USER_TYPE_VALUE }
+};
+
+/* Maps the class entries of bind_classes to their kind, built at startup */
+static HashTable bind_kinds;
+
+#define BIND_CLASS_KEY(ce) ((php5to7_ulong) (uintptr_t) (ce))
+
+void
+php_driver_bind_init(void)
+{
+  size_t i;
+
+  zend_hash_init(&bind_kinds, sizeof(bind_classes) / sizeof(bind_classes[0]), NULL, NULL, 1);
+
+  for (i = 0; i < sizeof(bind_classes) / sizeof(bind_classes[0]); i++) {
+#if PHP_MAJOR_VERSION >= 7
+    zval kind;
+    ZVAL_LONG(&kind, bind_classes[i].kind);
+    zend_hash_index_update(&bind_kinds, BIND_CLASS_KEY(*bind_classes[i].ce), &kind);
+#else
+    php_driver_bind_kind kind = bind_classes[i].kind;
+    zend_hash_index_update(&bind_kinds, BIND_CLASS_KEY(*bind_classes[i].ce),
+                           &kind, sizeof(kind), NULL);
+#endif
+  }
+}
+
+void
+php_driver_bind_destroy(void)
+{
+  zend_hash_destroy(&bind_kinds);
+}
+
+static php_driver_bind_kind
+bind_kind(zend_class_entry *ce TSRMLS_DC)
+{
+  size_t i;
+#if PHP_MAJOR_VERSION >= 7
+  zval *kind = zend_hash_index_find(&bind_kinds, BIND_CLASS_KEY(ce));
+
+  if (kind) {
+    return (php_driver_bind_kind) Z_LVAL_P(kind);
+  }
+#else
+  php_driver_bind_kind *kind;
+
+  if (zend_hash_index_find(&bind_kinds, BIND_CLASS_KEY(ce), (void **) &kind) == SUCCESS) {
+    return *kind;
+  }
+#endif
+
+  for (i = 0; i < sizeof(bind_classes) / sizeof(bind_classes[0]); i++) {
+    if (instanceof_function(ce, *bind_classes[i].ce TSRMLS_CC)) {
+      return bind_classes[i].kind;
+    }
+  }
+
+  return PHP_DRIVER_BIND_UNKNOWN;
+}
+
+/* Binds to the parameter at index, or to the named parameter when name is
+ * set */
+#define BIND(function, ...) \
+  CHECK_RESULT(name ? function##_by_name(statement, name, __VA_ARGS__) \
+                    : function(statement, index, __VA_ARGS__))
+
+#define BIND_NULL() \
+  CHECK_RESULT(name ? cass_statement_bind_null_by_name(statement, name) \
+                    : cass_statement_bind_null(statement, index))
+
+static int
+bind_argument(CassStatement *statement, size_t index, const char *name,
+              zval *value TSRMLS_DC)
+{
+  php_driver_bind_kind kind;
+
+  if (Z_TYPE_P(value) == IS_NULL)
+    BIND_NULL();
+
+  if (Z_TYPE_P(value) == IS_STRING)
+    BIND(cass_statement_bind_string, Z_STRVAL_P(value));
+
+  if (Z_TYPE_P(value) == IS_DOUBLE)
+    BIND(cass_statement_bind_double, Z_DVAL_P(value));
+
+  if (Z_TYPE_P(value) == IS_LONG)
+    BIND(cass_statement_bind_int32, Z_LVAL_P(value));
+
+  if (PHP5TO7_ZVAL_IS_TRUE_P(value))
+    BIND(cass_statement_bind_bool, cass_true);
+
+  if (PHP5TO7_ZVAL_IS_FALSE_P(value))
+    BIND(cass_statement_bind_bool, cass_false);
+
+  if (Z_TYPE_P(value) != IS_OBJECT)
+    return FAILURE;
+
+  kind = bind_kind(Z_OBJCE_P(value) TSRMLS_CC);
+  switch (kind) {
+  case PHP_DRIVER_BIND_FLOAT:
+    BIND(cass_statement_bind_float, PHP_DRIVER_GET_NUMERIC(value)->data.floating.value);
+  case PHP_DRIVER_BIND_BIGINT:
+    BIND(cass_statement_bind_int64, PHP_DRIVER_GET_NUMERIC(value)->data.bigint.value);
+  case PHP_DRIVER_BIND_SMALLINT:
+    BIND(cass_statement_bind_int16, PHP_DRIVER_GET_NUMERIC(value)->data.smallint.value);
+  case PHP_DRIVER_BIND_TINYINT:
+    BIND(cass_statement_bind_int8, PHP_DRIVER_GET_NUMERIC(value)->data.tinyint.value);
+  case PHP_DRIVER_BIND_TIMESTAMP:
+    BIND(cass_statement_bind_int64, PHP_DRIVER_GET_TIMESTAMP(value)->timestamp);
+  case PHP_DRIVER_BIND_DATE:
+    BIND(cass_statement_bind_uint32, PHP_DRIVER_GET_DATE(value)->date);
+  case PHP_DRIVER_BIND_TIME:
+    BIND(cass_statement_bind_int64, PHP_DRIVER_GET_TIME(value)->time);
+  case PHP_DRIVER_BIND_BLOB:
+    BIND(cass_statement_bind_bytes, PHP_DRIVER_GET_BLOB(value)->data, PHP_DRIVER_GET_BLOB(value)->size);
+  case PHP_DRIVER_BIND_VARINT:
+    {
+      size_t size;
+      const cass_byte_t *data = php_driver_varint_encoding(PHP_DRIVER_GET_NUMERIC(value), &size);
+      BIND(cass_statement_bind_bytes, data, size);
+    }
+  case PHP_DRIVER_BIND_DECIMAL:
+    {
+      php_driver_numeric *decimal = PHP_DRIVER_GET_NUMERIC(value);
+      size_t size;
+      const cass_byte_t *data = php_driver_decimal_encoding(decimal, &size);
+      BIND(cass_statement_bind_decimal, data, size, decimal->data.decimal.scale);
+    }
+  case PHP_DRIVER_BIND_UUID:
+    BIND(cass_statement_bind_uuid, PHP_DRIVER_GET_UUID(value)->uuid);
+  case PHP_DRIVER_BIND_INET:
+    BIND(cass_statement_bind_inet, PHP_DRIVER_GET_INET(value)->inet);
+  case PHP_DRIVER_BIND_DURATION:
+    {
+      php_driver_duration *duration = PHP_DRIVER_GET_DURATION(value);
+      BIND(cass_statement_bind_duration, duration->months, duration->days, duration->nanos);
+    }
+  case PHP_DRIVER_BIND_SET:
+  case PHP_DRIVER_BIND_MAP:
+  case PHP_DRIVER_BIND_COLLECTION:
+    {
+      CassCollection *collection;
+      int converted;
+
+      switch (kind) {
+      case PHP_DRIVER_BIND_SET:
+        converted = php_driver_collection_from_set(PHP_DRIVER_GET_SET(value), &collection TSRMLS_CC);
+        break;
+      case PHP_DRIVER_BIND_MAP:
+        converted = php_driver_collection_from_map(PHP_DRIVER_GET_MAP(value), &collection TSRMLS_CC);
+        break;
+      default:
+        converted = php_driver_collection_from_collection(PHP_DRIVER_GET_COLLECTION(value), &collection TSRMLS_CC);
+        break;
+      }
+      if (!converted)
+        return FAILURE;
+
+      BIND(cass_statement_bind_collection, collection);
+    }
+  case PHP_DRIVER_BIND_TUPLE:
+    {
+      CassError rc;
+      CassTuple *tup;
+      if (!php_driver_tuple_from_tuple(PHP_DRIVER_GET_TUPLE(value), &tup TSRMLS_CC))
+        return FAILURE;
+
+      rc = name ? cass_statement_bind_tuple_by_name(statement, name, tup)
+                : cass_statement_bind_tuple(statement, index, tup);
+      cass_tuple_free(tup);
+      CHECK_RESULT(rc);
+    }
+  case PHP_DRIVER_BIND_USER_TYPE_VALUE:
+    {
+      CassError rc;
+      CassUserType *ut;
+      if (!php_driver_user_type_from_user_type_value(PHP_DRIVER_GET_USER_TYPE_VALUE(value), &ut TSRMLS_CC))
+        return FAILURE;
+
+      rc = name ? cass_statement_bind_user_type_by_name(statement, name, ut)
+                : cass_statement_bind_user_type(statement, index, ut);
+      cass_user_type_free(ut);
+      CHECK_RESULT(rc);
+    }
+  default:
+    return FAILURE;
+  }
+}
+
+int
+php_driver_bind_argument_by_index(CassStatement *statement, size_t index, zval *value TSRMLS_DC)
+{
+  return bind_argument(statement, index, NULL, value TSRMLS_CC);
+}
+
+int
+php_driver_bind_argument_by_name(CassStatement *statement, const char *name,
+                                 zval *value TSRMLS_DC)
+{
+  return bind_argument(statement, 0, name, value TSRMLS_CC);
+}
+
+/* Binds to the parameter at index, or appends to collection when it is set */
+#define BIND_OR_APPEND_RC(function, ...) \
+  (collection ? cass_collection_append_##function(collection, __VA_ARGS__) \
+              : cass_statement_bind_##function(statement, index, __VA_ARGS__))
+
+#define BIND_OR_APPEND(function, ...) \
+  CHECK_RESULT(BIND_OR_APPEND_RC(function, __VA_ARGS__))
+
+/* Returned by bind_native() for values it has no conversion for */
+#define PHP_DRIVER_BIND_UNCONVERTED 1
+
+static int bind_native(CassStatement *statement, size_t index,
+                       CassCollection *collection, const CassDataType *type,
+                       zval *value TSRMLS_DC);
+
+/* Writes the shortest two's complement representation of value, which is how
+ * varints are encoded, and returns its first byte */
+static cass_byte_t *
+encode_long(php5to7_long value, cass_byte_t bytes[8], size_t *size)
+{
+  cass_uint64_t bits = (cass_uint64_t) (cass_int64_t) value;
+  size_t start = 0;
+  int i;
+
+  for (i = 7; i >= 0; i--) {
+    bytes[i] = (cass_byte_t) (bits & 0xFF);
+    bits >>= 8;
+  }
+
+  while (start < 7 &&
+         ((bytes[start] == 0x00 && !(bytes[start + 1] & 0x80)) ||
+          (bytes[start] == 0xFF && (bytes[start + 1] & 0x80)))) {
+    start++;
+  }
+
+  *size = 8 - start;
+  return bytes + start;
+}
+
+/* Reads a UUID from its 36 characters string representation or from its 16
+ * bytes binary representation */
+static int
+parse_uuid(zval *value, CassUuid *uuid TSRMLS_DC)
+{
+  const unsigned char *bytes = (const unsigned char *) Z_STRVAL_P(value);
+  int i;
+
+  if (Z_STRLEN_P(value) == 16) {
+    uuid->time_and_version  = (cass_uint64_t) bytes[0] << 24;
+    uuid->time_and_version |= (cass_uint64_t) bytes[1] << 16;
+    uuid->time_and_version |= (cass_uint64_t) bytes[2] << 8;
+    uuid->time_and_version |= (cass_uint64_t) bytes[3];
+    uuid->time_and_version |= (cass_uint64_t) bytes[4] << 40;
+    uuid->time_and_version |= (cass_uint64_t) bytes[5] << 32;
+    uuid->time_and_version |= (cass_uint64_t) bytes[6] << 56;
+    uuid->time_and_version |= (cass_uint64_t) bytes[7] << 48;
+
+    uuid->clock_seq_and_node = 0;
+    for (i = 8; i < 16; i++) {
+      uuid->clock_seq_and_node = (uuid->clock_seq_and_node << 8) | bytes[i];
+    }
+    return SUCCESS;
+  }
+
+  if (cass_uuid_from_string(Z_STRVAL_P(value), uuid) != CASS_OK) {
+    zend_throw_exception_ex(php_driver_invalid_argument_exception_ce, 0 TSRMLS_CC,
+                            "Invalid UUID: '%s'", Z_STRVAL_P(value));
+    return FAILURE;
+  }
+
+  return SUCCESS;
+}
+
+/* The kind of object that holds a value of the given type */
+static php_driver_bind_kind
+bind_kind_of_type(CassValueType type)
+{
+  switch (type) {
+  case CASS_VALUE_TYPE_FLOAT:     return PHP_DRIVER_BIND_FLOAT;
+  case CASS_VALUE_TYPE_BIGINT:
+  case CASS_VALUE_TYPE_COUNTER:   return PHP_DRIVER_BIND_BIGINT;
+  case CASS_VALUE_TYPE_SMALL_INT: return PHP_DRIVER_BIND_SMALLINT;
+  case CASS_VALUE_TYPE_TINY_INT:  return PHP_DRIVER_BIND_TINYINT;
+  case CASS_VALUE_TYPE_TIMESTAMP: return PHP_DRIVER_BIND_TIMESTAMP;
+  case CASS_VALUE_TYPE_DATE:      return PHP_DRIVER_BIND_DATE;
+  case CASS_VALUE_TYPE_TIME:      return PHP_DRIVER_BIND_TIME;
+  case CASS_VALUE_TYPE_BLOB:      return PHP_DRIVER_BIND_BLOB;
+  case CASS_VALUE_TYPE_VARINT:    return PHP_DRIVER_BIND_VARINT;
+  case CASS_VALUE_TYPE_DECIMAL:   return PHP_DRIVER_BIND_DECIMAL;
+  case CASS_VALUE_TYPE_UUID:
+  case CASS_VALUE_TYPE_TIMEUUID:  return PHP_DRIVER_BIND_UUID;
+  case CASS_VALUE_TYPE_INET:      return PHP_DRIVER_BIND_INET;
+  case CASS_VALUE_TYPE_DURATION:  return PHP_DRIVER_BIND_DURATION;
+  case CASS_VALUE_TYPE_SET:       return PHP_DRIVER_BIND_SET;
+  case CASS_VALUE_TYPE_MAP:       return PHP_DRIVER_BIND_MAP;
+  case CASS_VALUE_TYPE_LIST:      return PHP_DRIVER_BIND_COLLECTION;
+  case CASS_VALUE_TYPE_TUPLE:     return PHP_DRIVER_BIND_TUPLE;
+  case CASS_VALUE_TYPE_UDT:       return PHP_DRIVER_BIND_USER_TYPE_VALUE;
+  default:                        return PHP_DRIVER_BIND_UNKNOWN;
+  }
+}
+
+/* Appends an element of a PHP array to a collection, either a native value
+ * or an object of the element's type */
+static int
+append_element(CassCollection *collection, const CassDataType *type, zval *value TSRMLS_DC)
+{
+  CassValueType value_type = cass_data_type_type(type);
+  php_driver_bind_kind kind = bind_kind_of_type(value_type);
+  int rc;
+
+  if (Z_TYPE_P(value) == IS_OBJECT && kind != PHP_DRIVER_BIND_UNKNOWN &&
+      bind_kind(Z_OBJCE_P(value) TSRMLS_CC) == kind) {
+    return php_driver_collection_append(collection, value, value_type TSRMLS_CC)
+           ? SUCCESS : FAILURE;
+  }
+
+  rc = bind_native(NULL, 0, collection, type, value TSRMLS_CC);
+  if (rc == PHP_DRIVER_BIND_UNCONVERTED) {
+    throw_invalid_argument(value, "element", "a value of the collection's type");
+    return FAILURE;
+  }
+
+  return rc;
+}
+
+/* Builds a list, a set or a map of the given type from a PHP array, the keys
+ * of the array being the keys of a map */
+static int
+collection_from_array(const CassDataType *type, HashTable *values,
+                      CassCollection **output TSRMLS_DC)
+{
+  int is_map = cass_data_type_type(type) == CASS_VALUE_TYPE_MAP;
+  const CassDataType *key_type = cass_data_type_sub_data_type(type, 0);
+  const CassDataType *value_type = is_map ? cass_data_type_sub_data_type(type, 1) : key_type;
+  CassCollection *collection;
+  php5to7_zval *current;
+  php5to7_ulong num_key;
+  int rc = SUCCESS;
+
+  if (!key_type || !value_type) {
+    zend_throw_exception_ex(php_driver_runtime_exception_ce, 0 TSRMLS_CC,
+                            "Unsupported collection type");
+    return FAILURE;
+  }
+
+  collection = cass_collection_new_from_data_type(type, zend_hash_num_elements(values));
+
+#if PHP_MAJOR_VERSION >= 7
+  zend_string *str_key;
+  ZEND_HASH_FOREACH_KEY_VAL(values, num_key, str_key, current) {
+    if (is_map) {
+      zval key;
+      if (str_key) {
+        ZVAL_STR(&key, str_key);
+      } else if (cass_data_type_type(key_type) == CASS_VALUE_TYPE_TEXT ||
+                 cass_data_type_type(key_type) == CASS_VALUE_TYPE_VARCHAR ||
+                 cass_data_type_type(key_type) == CASS_VALUE_TYPE_ASCII) {
+        /* PHP turns numeric string keys into integers */
+        ZVAL_STR(&key, zend_long_to_str((zend_long) num_key));
+      } else {
+        ZVAL_LONG(&key, (zend_long) num_key);
+      }
+      rc = append_element(collection, key_type, &key TSRMLS_CC);
+      if (!str_key && Z_TYPE(key) == IS_STRING) {
+        zval_ptr_dtor(&key);
+      }
+      if (rc == FAILURE) break;
+    }
+#else
+  char *str_key;
+  uint str_len;
+  PHP5TO7_ZEND_HASH_FOREACH_KEY_VAL(values, num_key, str_key, str_len, current) {
+    if (is_map) {
+      zval key;
+      INIT_ZVAL(key);
+      if (str_key) {
+        ZVAL_STRINGL(&key, str_key, str_len - 1, 0);
+      } else if (cass_data_type_type(key_type) == CASS_VALUE_TYPE_TEXT ||
+                 cass_data_type_type(key_type) == CASS_VALUE_TYPE_VARCHAR ||
+                 cass_data_type_type(key_type) == CASS_VALUE_TYPE_ASCII) {
+        /* PHP turns numeric string keys into integers */
+        char *formatted;
+        int formatted_len = spprintf(&formatted, 0, "%ld", (long) num_key);
+        ZVAL_STRINGL(&key, formatted, formatted_len, 0);
+      } else {
+        ZVAL_LONG(&key, (long) num_key);
+      }
+      rc = append_element(collection, key_type, &key TSRMLS_CC);
+      if (!str_key && Z_TYPE(key) == IS_STRING) {
+        efree(Z_STRVAL(key));
+      }
+      if (rc == FAILURE) break;
+    }
+#endif
+    rc = append_element(collection, value_type, PHP5TO7_ZVAL_MAYBE_DEREF(current) TSRMLS_CC);
+    if (rc == FAILURE) break;
+  } PHP5TO7_ZEND_HASH_FOREACH_END(values);
+
+  if (rc == FAILURE) {
+    cass_collection_free(collection);
+    return FAILURE;
+  }
+
+  *output = collection;
+  return SUCCESS;
+}
+
+/* Binds a native PHP value to the parameter at index, or appends it to
+ * collection when it is set, converting it to the given type. Integers are
+ * taken as milliseconds since the epoch for timestamps and UUIDs can be given
+ * as strings of 36 characters or of 16 bytes. */
+static int
+bind_native(CassStatement *statement, size_t index, CassCollection *collection,
+            const CassDataType *type, zval *value TSRMLS_DC)
+{
+  switch (cass_data_type_type(type)) {
+  case CASS_VALUE_TYPE_ASCII:
+  case CASS_VALUE_TYPE_TEXT:
+  case CASS_VALUE_TYPE_VARCHAR:
+    if (Z_TYPE_P(value) == IS_STRING)
+      BIND_OR_APPEND(string_n, Z_STRVAL_P(value), Z_STRLEN_P(value));
+    break;
+  case CASS_VALUE_TYPE_INT:
+    if (Z_TYPE_P(value) == IS_LONG) {
+      if (Z_LVAL_P(value) < INT32_MIN || Z_LVAL_P(value) > INT32_MAX) {
+        zend_throw_exception_ex(php_driver_range_exception_ce, 0 TSRMLS_CC,
+          "value must be between -2147483648 and 2147483647, %ld given", (long) Z_LVAL_P(value));
+        return FAILURE;
+      }
+      BIND_OR_APPEND(int32, (cass_int32_t) Z_LVAL_P(value));
+    }
+    break;
+  case CASS_VALUE_TYPE_BIGINT:
+  case CASS_VALUE_TYPE_COUNTER:
+  case CASS_VALUE_TYPE_TIMESTAMP:
+    if (Z_TYPE_P(value) == IS_LONG)
+      BIND_OR_APPEND(int64, (cass_int64_t) Z_LVAL_P(value));
+    break;
+  case CASS_VALUE_TYPE_SMALL_INT:
+    if (Z_TYPE_P(value) == IS_LONG) {
+      if (Z_LVAL_P(value) < INT16_MIN || Z_LVAL_P(value) > INT16_MAX) {
+        zend_throw_exception_ex(php_driver_range_exception_ce, 0 TSRMLS_CC,
+          "value must be between -32768 and 32767, %ld given", (long) Z_LVAL_P(value));
+        return FAILURE;
+      }
+      BIND_OR_APPEND(int16, (cass_int16_t) Z_LVAL_P(value));
+    }
+    break;
+  case CASS_VALUE_TYPE_TINY_INT:
+    if (Z_TYPE_P(value) == IS_LONG) {
+      if (Z_LVAL_P(value) < INT8_MIN || Z_LVAL_P(value) > INT8_MAX) {
+        zend_throw_exception_ex(php_driver_range_exception_ce, 0 TSRMLS_CC,
+          "value must be between -128 and 127, %ld given", (long) Z_LVAL_P(value));
+        return FAILURE;
+      }
+      BIND_OR_APPEND(int8, (cass_int8_t) Z_LVAL_P(value));
+    }
+    break;
+  case CASS_VALUE_TYPE_DOUBLE:
+    if (Z_TYPE_P(value) == IS_DOUBLE)
+      BIND_OR_APPEND(double, Z_DVAL_P(value));
+    if (Z_TYPE_P(value) == IS_LONG)
+      BIND_OR_APPEND(double, (cass_double_t) Z_LVAL_P(value));
+    break;
+  case CASS_VALUE_TYPE_FLOAT:
+    if (Z_TYPE_P(value) == IS_DOUBLE)
+      BIND_OR_APPEND(float, (cass_float_t) Z_DVAL_P(value));
+    if (Z_TYPE_P(value) == IS_LONG)
+      BIND_OR_APPEND(float, (cass_float_t) Z_LVAL_P(value));
+    break;
+  case CASS_VALUE_TYPE_BOOLEAN:
+    if (PHP5TO7_ZVAL_IS_BOOL_P(value))
+      BIND_OR_APPEND(bool, PHP5TO7_ZVAL_IS_TRUE_P(value) ? cass_true : cass_false);
+    break;
+  case CASS_VALUE_TYPE_BLOB:
+    if (Z_TYPE_P(value) == IS_STRING)
+      BIND_OR_APPEND(bytes, (const cass_byte_t *) Z_STRVAL_P(value), Z_STRLEN_P(value));
+    break;
+  case CASS_VALUE_TYPE_UUID:
+  case CASS_VALUE_TYPE_TIMEUUID:
+    if (Z_TYPE_P(value) == IS_STRING &&
+        (Z_STRLEN_P(value) == 16 || Z_STRLEN_P(value) == 36)) {
+      CassUuid uuid;
+      if (parse_uuid(value, &uuid TSRMLS_CC) == FAILURE)
+        return FAILURE;
+      BIND_OR_APPEND(uuid, uuid);
+    }
+    break;
+  case CASS_VALUE_TYPE_VARINT:
+  case CASS_VALUE_TYPE_DECIMAL:
+    {
+      int is_decimal = cass_data_type_type(type) == CASS_VALUE_TYPE_DECIMAL;
+
+      if (Z_TYPE_P(value) == IS_LONG) {
+        cass_byte_t bytes[8];
+        size_t size;
+        cass_byte_t *data = encode_long(Z_LVAL_P(value), bytes, &size);
+        if (is_decimal)
+          BIND_OR_APPEND(decimal, data, size, 0);
+        BIND_OR_APPEND(bytes, data, size);
+      }
+
+      if (Z_TYPE_P(value) == IS_STRING) {
+        CassError rc;
+        mpz_t number;
+        long scale = 0;
+        size_t size;
+        cass_byte_t *data;
+        int parsed;
+
+        mpz_init(number);
+        parsed = is_decimal
+                 ? php_driver_parse_decimal(Z_STRVAL_P(value), Z_STRLEN_P(value), &number, &scale TSRMLS_CC)
+                 : php_driver_parse_varint(Z_STRVAL_P(value), Z_STRLEN_P(value), &number TSRMLS_CC);
+        if (!parsed) {
+          mpz_clear(number);
+          return FAILURE;
+        }
+
+        data = (cass_byte_t *) export_twos_complement(number, &size);
+        mpz_clear(number);
+        rc = is_decimal ? BIND_OR_APPEND_RC(decimal, data, size, (cass_int32_t) scale)
+                        : BIND_OR_APPEND_RC(bytes, data, size);
+        free(data);
+        CHECK_RESULT(rc);
+      }
+    }
+    break;
+  case CASS_VALUE_TYPE_LIST:
+  case CASS_VALUE_TYPE_SET:
+  case CASS_VALUE_TYPE_MAP:
+    if (Z_TYPE_P(value) == IS_ARRAY) {
+      CassError rc;
+      CassCollection *elements;
+      if (collection_from_array(type, Z_ARRVAL_P(value), &elements TSRMLS_CC) == FAILURE)
+        return FAILURE;
+
+      rc = BIND_OR_APPEND_RC(collection, elements);
+      cass_collection_free(elements);
+      CHECK_RESULT(rc);
+    }
+    break;
+  default:
+    break;
+  }
+
+  return PHP_DRIVER_BIND_UNCONVERTED;
+}
+
+/* The binders of a bind plan handle the value expected by their parameter's
+ * type with a single check, then native PHP values that can be converted to
+ * that type, and fall back to binding by the value's own type otherwise so
+ * that mismatches are reported the same way. */
+#define PHP_DRIVER_IS_INSTANCE(value, ce) \
+  (Z_TYPE_P(value) == IS_OBJECT && Z_OBJCE_P(value) == (ce))
+
+static int
+bind_value(CassStatement *statement, size_t index, const CassDataType *type,
+           zval *value TSRMLS_DC)
+{
+  int rc = bind_native(statement, index, NULL, type, value TSRMLS_CC);
+
+  if (rc != PHP_DRIVER_BIND_UNCONVERTED)
+    return rc;
+
+  return php_driver_bind_argument_by_index(statement, index, value TSRMLS_CC);
+}
+
+static int
+bind_bigint(CassStatement *statement, size_t index, const CassDataType *type,
+               zval *value TSRMLS_DC)
+{
+  if (PHP_DRIVER_IS_INSTANCE(value, php_driver_bigint_ce))
+    CHECK_RESULT(cass_statement_bind_int64(statement, index,
+                                           PHP_DRIVER_GET_NUMERIC(value)->data.bigint.value));
+
+  return bind_value(statement, index, type, value TSRMLS_CC);
+}
+
+static int
+bind_smallint(CassStatement *statement, size_t index, const CassDataType *type,
+               zval *value TSRMLS_DC)
+{
+  if (PHP_DRIVER_IS_INSTANCE(value, php_driver_smallint_ce))
+    CHECK_RESULT(cass_statement_bind_int16(statement, index,
+                                           PHP_DRIVER_GET_NUMERIC(value)->data.smallint.value));
+
+  return bind_value(statement, index, type, value TSRMLS_CC);
+}
+
+static int
+bind_tinyint(CassStatement *statement, size_t index, const CassDataType *type,
+               zval *value TSRMLS_DC)
+{
+  if (PHP_DRIVER_IS_INSTANCE(value, php_driver_tinyint_ce))
+    CHECK_RESULT(cass_statement_bind_int8(statement, index,
+                                          PHP_DRIVER_GET_NUMERIC(value)->data.tinyint.value));
+
+  return bind_value(statement, index, type, value TSRMLS_CC);
+}
+
+static int
+bind_float(CassStatement *statement, size_t index, const CassDataType *type,
+               zval *value TSRMLS_DC)
+{
+  if (PHP_DRIVER_IS_INSTANCE(value, php_driver_float_ce))
+    CHECK_RESULT(cass_statement_bind_float(statement, index,
+                                           PHP_DRIVER_GET_NUMERIC(value)->data.floating.value));
+
+  return bind_value(statement, index, type, value TSRMLS_CC);
+}
+
+static int
+bind_timestamp(CassStatement *statement, size_t index, const CassDataType *type,
+               zval *value TSRMLS_DC)
+{
+  if (PHP_DRIVER_IS_INSTANCE(value, php_driver_timestamp_ce))
+    CHECK_RESULT(cass_statement_bind_int64(statement, index,
+                                           PHP_DRIVER_GET_TIMESTAMP(value)->timestamp));
+
+  return bind_value(statement, index, type, value TSRMLS_CC);
+}
+
+static int
+bind_date(CassStatement *statement, size_t index, const CassDataType *type,
+               zval *value TSRMLS_DC)
+{
+  if (PHP_DRIVER_IS_INSTANCE(value, php_driver_date_ce))
+    CHECK_RESULT(cass_statement_bind_uint32(statement, index,
+                                            PHP_DRIVER_GET_DATE(value)->date));
+
+  return bind_value(statement, index, type, value TSRMLS_CC);
+}
+
+static int
+bind_time(CassStatement *statement, size_t index, const CassDataType *type,
+               zval *value TSRMLS_DC)
+{
+  if (PHP_DRIVER_IS_INSTANCE(value, php_driver_time_ce))
+    CHECK_RESULT(cass_statement_bind_int64(statement, index,
+                                           PHP_DRIVER_GET_TIME(value)->time));
+
+  return bind_value(statement, index, type, value TSRMLS_CC);
+}
+
+static int
+bind_blob(CassStatement *statement, size_t index, const CassDataType *type,
+               zval *value TSRMLS_DC)
+{
+  if (PHP_DRIVER_IS_INSTANCE(value, php_driver_blob_ce)) {
+    php_driver_blob *blob = PHP_DRIVER_GET_BLOB(value);
+    CHECK_RESULT(cass_statement_bind_bytes(statement, index, blob->data, blob->size));
+  }
+
+  return bind_value(statement, index, type, value TSRMLS_CC);
+}
+
+static int
+bind_uuid(CassStatement *statement, size_t index, const CassDataType *type,
+               zval *value TSRMLS_DC)
+{
+  if (PHP_DRIVER_IS_INSTANCE(value, php_driver_uuid_ce) ||
+      PHP_DRIVER_IS_INSTANCE(value, php_driver_timeuuid_ce))
+    CHECK_RESULT(cass_statement_bind_uuid(statement, index,
+                                          PHP_DRIVER_GET_UUID(value)->uuid));
+
+  return bind_value(statement, index, type, value TSRMLS_CC);
+}
+
+static int
+bind_inet(CassStatement *statement, size_t index, const CassDataType *type,
+               zval *value TSRMLS_DC)
+{
+  if (PHP_DRIVER_IS_INSTANCE(value, php_driver_inet_ce))
+    CHECK_RESULT(cass_statement_bind_inet(statement, index,
+                                          PHP_DRIVER_GET_INET(value)->inet));
+
+  return bind_value(statement, index, type, value TSRMLS_CC);
+}
+
+static php_driver_binder
+bind_plan_binder(const CassDataType *data_type)
+{
+  switch (cass_data_type_type(data_type)) {
+  case CASS_VALUE_TYPE_BIGINT:
+  case CASS_VALUE_TYPE_COUNTER:
+    return bind_bigint;
+  case CASS_VALUE_TYPE_SMALL_INT:
+    return bind_smallint;
+  case CASS_VALUE_TYPE_TINY_INT:
+    return bind_tinyint;
+  case CASS_VALUE_TYPE_FLOAT:
+    return bind_float;
+  case CASS_VALUE_TYPE_TIMESTAMP:
+    return bind_timestamp;
+  case CASS_VALUE_TYPE_DATE:
+    return bind_date;
+  case CASS_VALUE_TYPE_TIME:
+    return bind_time;
+  case CASS_VALUE_TYPE_BLOB:
+    return bind_blob;
+  case CASS_VALUE_TYPE_UUID:
+  case CASS_VALUE_TYPE_TIMEUUID:
+    return bind_uuid;
+  case CASS_VALUE_TYPE_INET:
+    return bind_inet;
+  default:
+    return bind_value;
+  }
+}
+
+void
+php_driver_bind_plan_init(php_driver_statement *prepared)
+{
+  const CassPrepared *cass_prepared = prepared->data.prepared.prepared;
+  size_t count = 0;
+  size_t i;
+
+  while (cass_prepared_parameter_data_type(cass_prepared, count) != NULL) {
+    count++;
+  }
+
+  prepared->data.prepared.binder_count = count;
+  prepared->data.prepared.binders = NULL;
+
+  if (count == 0) {
+    return;
+  }
+
+  prepared->data.prepared.binders = (php_driver_binder *) ecalloc(count, sizeof(php_driver_binder));
+  for (i = 0; i < count; i++) {
+    prepared->data.prepared.binders[i] =
+        bind_plan_binder(cass_prepared_parameter_data_type(cass_prepared, i));
+  }
+
+#if PHP_MAJOR_VERSION >= 7
+  /* Parameters are indexed by their lowercased name, which is the name an
+   * unquoted argument name matches. Names shared by several parameters are
+   * left to cass_statement_bind_*_by_name() which binds all of them. */
+  ALLOC_HASHTABLE(prepared->data.prepared.parameter_indices);
+  zend_hash_init(prepared->data.prepared.parameter_indices, count, NULL, NULL, 0);
+
+  for (i = 0; i < count; i++) {
+    const char *name;
+    size_t name_length;
+    zend_string *original;
+    zend_string *key;
+    zval *existing;
+    zval index;
+
+    if (cass_prepared_parameter_name(cass_prepared, i, &name, &name_length) != CASS_OK) {
+      continue;
+    }
+
+    original = zend_string_init(name, name_length, 0);
+    key = zend_string_tolower(original);
+    zend_string_release(original);
+    existing = zend_hash_find(prepared->data.prepared.parameter_indices, key);
+    if (existing) {
+      ZVAL_LONG(existing, -1);
+    } else {
+      ZVAL_LONG(&index, (zend_long) i);
+      zend_hash_add_new(prepared->data.prepared.parameter_indices, key, &index);
+    }
+    zend_string_release(key);
+  }
+#endif
+}
+
+void
+php_driver_bind_plan_destroy(php_driver_statement *prepared)
+{
+  if (prepared->data.prepared.binders) {
+    efree(prepared->data.prepared.binders);
+    prepared->data.prepared.binders = NULL;
+  }
+  prepared->data.prepared.binder_count = 0;
+
+#if PHP_MAJOR_VERSION >= 7
+  if (prepared->data.prepared.parameter_indices) {
+    zend_hash_destroy(prepared->data.prepared.parameter_indices);
+    FREE_HASHTABLE(prepared->data.prepared.parameter_indices);
+    prepared->data.prepared.parameter_indices = NULL;
+  }
+#endif
+}
+
+php5to7_long
+php_driver_bind_plan_index(const php_driver_statement *source,
+                           const char *name, size_t name_length)
+{
+#if PHP_MAJOR_VERSION >= 7
+  zval *index;
+
+  if (source->type != PHP_DRIVER_PREPARED_STATEMENT ||
+      !source->data.prepared.parameter_indices) {
+    return -1;
+  }
+
+  index = zend_hash_str_find(source->data.prepared.parameter_indices, name, name_length);
+  return index ? Z_LVAL_P(index) : -1;
+#else
+  return -1;
+#endif
+}
+
+/* Binds an argument with the binder of its parameter, which is given the
+ * parameter's type to convert native values */
+static int
+bind_plan_argument(CassStatement *statement, const php_driver_statement *source,
+                   size_t index, zval *value TSRMLS_DC)
+{
+  const CassDataType *type =
+      cass_prepared_parameter_data_type(source->data.prepared.prepared, index);
+
+  return source->data.prepared.binders[index](statement, index, type, value TSRMLS_CC);
+}
+
+int
+php_driver_bind_argument(CassStatement *statement,
+                         const php_driver_statement *source,
+                         php5to7_ulong index, const char *name, size_t name_length,
+                         zval *value TSRMLS_DC)
+{
+  if (name) {
+    php5to7_long position = php_driver_bind_plan_index(source, name, name_length);
+
+    if (position < 0)
+      return php_driver_bind_argument_by_name(statement, name, value TSRMLS_CC);
+
+    index = (php5to7_ulong) position;
+  }
+
+  if (source->type == PHP_DRIVER_PREPARED_STATEMENT &&
+      index < source->data.prepared.binder_count)
+    return bind_plan_argument(statement, source, index, value TSRMLS_CC);
+
+  return php_driver_bind_argument_by_index(statement, index, value TSRMLS_CC);
+}
+
+int
+php_driver_bind_arguments(CassStatement *statement,
+                          const php_driver_statement *source,
+                          HashTable *arguments TSRMLS_DC)
+{
+  int rc = SUCCESS;
+
+  php5to7_zval *current;
+  php5to7_ulong num_key;
+
+#if PHP_MAJOR_VERSION >= 7
+  zend_string *key;
+  ZEND_HASH_FOREACH_KEY_VAL(arguments, num_key, key, current) {
+    rc = php_driver_bind_argument(statement, source, num_key,
+                                  key ? ZSTR_VAL(key) : NULL, key ? ZSTR_LEN(key) : 0,
+                                  PHP5TO7_ZVAL_MAYBE_DEREF(current) TSRMLS_CC);
+#else
+  char *str_key;
+  uint str_len;
+  PHP5TO7_ZEND_HASH_FOREACH_KEY_VAL(arguments, num_key, str_key, str_len, current) {
+    rc = php_driver_bind_argument(statement, source, num_key,
+                                  str_key, str_key ? str_len - 1 : 0,
+                                  PHP5TO7_ZVAL_MAYBE_DEREF(current) TSRMLS_CC);
+#endif
+    if (rc == FAILURE) break;
+  } PHP5TO7_ZEND_HASH_FOREACH_END(arguments);
+
+  return rc;
+}
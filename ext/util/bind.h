@@ -0,0 +1,53 @@
+/**
+ * Copyright 2015-2017 DataStax, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PHP_DRIVER_UTIL_BIND_H
+#define PHP_DRIVER_UTIL_BIND_H
+
+/* Builds the table used to find how to bind a value from its class entry,
+ * called once all the classes are registered */
+void php_driver_bind_init(void);
+void php_driver_bind_destroy(void);
+
+int php_driver_bind_argument_by_index(CassStatement *statement, size_t index,
+                                      zval *value TSRMLS_DC);
+int php_driver_bind_argument_by_name(CassStatement *statement, const char *name,
+                                     zval *value TSRMLS_DC);
+
+/* Binds a positional argument, or a named argument when name is set,
+ * prepared statements use the binders of their bind plan */
+int php_driver_bind_argument(CassStatement *statement,
+                             const php_driver_statement *source,
+                             php5to7_ulong index, const char *name, size_t name_length,
+                             zval *value TSRMLS_DC);
+
+/* Binds positional and named arguments, prepared statements use the binders
+ * of their bind plan */
+int php_driver_bind_arguments(CassStatement *statement,
+                              const php_driver_statement *source,
+                              HashTable *arguments TSRMLS_DC);
+
+/* Chooses a binder for each parameter of a prepared statement from its type */
+void php_driver_bind_plan_init(php_driver_statement *prepared);
+void php_driver_bind_plan_destroy(php_driver_statement *prepared);
+
+/* Returns the position of the only parameter of a prepared statement an
+ * argument name refers to, or -1 when the name has to be resolved by the
+ * driver */
+php5to7_long php_driver_bind_plan_index(const php_driver_statement *source,
+                                        const char *name, size_t name_length);
+
+#endif /* PHP_DRIVER_UTIL_BIND_H */
@@ -278,7 +278,7 @@ php_driver_value_type(char *type, CassValueType *value_type TSRMLS_DC)
   return 1;
 }
 
-static int
+int
 php_driver_collection_append(CassCollection *collection, zval *value, CassValueType type TSRMLS_DC)
 {
   int result = 1;
@@ -291,7 +291,7 @@ php_driver_collection_append(CassCollection *collection, zval *value, CassValueT
   php_driver_inet       *inet;
   php_driver_duration   *duration;
   size_t                size;
-  cass_byte_t          *data;
+  const cass_byte_t    *data;
   php_driver_collection *coll;
   php_driver_map        *map;
   php_driver_set        *set;
@@ -360,15 +360,13 @@ php_driver_collection_append(CassCollection *collection, zval *value, CassValueT
     break;
   case CASS_VALUE_TYPE_VARINT:
     numeric = PHP_DRIVER_GET_NUMERIC(value);
-    data = (cass_byte_t *) export_twos_complement(numeric->data.varint.value, &size);
+    data = php_driver_varint_encoding(numeric, &size);
     CHECK_ERROR(cass_collection_append_bytes(collection, data, size));
-    free(data);
     break;
   case CASS_VALUE_TYPE_DECIMAL:
     numeric = PHP_DRIVER_GET_NUMERIC(value);
-    data = (cass_byte_t *) export_twos_complement(numeric->data.decimal.value, &size);
+    data = php_driver_decimal_encoding(numeric, &size);
     CHECK_ERROR(cass_collection_append_decimal(collection, data, size, numeric->data.decimal.scale));
-    free(data);
     break;
   case CASS_VALUE_TYPE_DURATION:
     duration = PHP_DRIVER_GET_DURATION(value);
@@ -429,7 +427,7 @@ php_driver_tuple_set(CassTuple *tuple, php5to7_ulong index, zval *value, CassVal
   php_driver_inet       *inet;
   php_driver_duration   *duration;
   size_t                size;
-  cass_byte_t          *data;
+  const cass_byte_t    *data;
   php_driver_collection *coll;
   php_driver_map        *map;
   php_driver_set        *set;
@@ -503,15 +501,13 @@ php_driver_tuple_set(CassTuple *tuple, php5to7_ulong index, zval *value, CassVal
     break;
   case CASS_VALUE_TYPE_VARINT:
     numeric = PHP_DRIVER_GET_NUMERIC(value);
-    data = (cass_byte_t *) export_twos_complement(numeric->data.varint.value, &size);
+    data = php_driver_varint_encoding(numeric, &size);
     CHECK_ERROR(cass_tuple_set_bytes(tuple, index, data, size));
-    free(data);
     break;
   case CASS_VALUE_TYPE_DECIMAL:
     numeric = PHP_DRIVER_GET_NUMERIC(value);
-    data = (cass_byte_t *) export_twos_complement(numeric->data.decimal.value, &size);
+    data = php_driver_decimal_encoding(numeric, &size);
     CHECK_ERROR(cass_tuple_set_decimal(tuple, index, data, size, numeric->data.decimal.scale));
-    free(data);
     break;
   case CASS_VALUE_TYPE_DURATION:
     duration = PHP_DRIVER_GET_DURATION(value);
@@ -574,7 +570,7 @@ php_driver_user_type_set(CassUserType *ut,
   php_driver_inet       *inet;
   php_driver_duration   *duration;
   size_t                size;
-  cass_byte_t          *data;
+  const cass_byte_t    *data;
   php_driver_collection *coll;
   php_driver_map        *map;
   php_driver_set        *set;
@@ -648,15 +644,13 @@ php_driver_user_type_set(CassUserType *ut,
     break;
   case CASS_VALUE_TYPE_VARINT:
     numeric = PHP_DRIVER_GET_NUMERIC(value);
-    data = (cass_byte_t *) export_twos_complement(numeric->data.varint.value, &size);
+    data = php_driver_varint_encoding(numeric, &size);
     CHECK_ERROR(cass_user_type_set_bytes_by_name(ut, name, data, size));
-    free(data);
     break;
   case CASS_VALUE_TYPE_DECIMAL:
     numeric = PHP_DRIVER_GET_NUMERIC(value);
-    data = (cass_byte_t *) export_twos_complement(numeric->data.decimal.value, &size);
+    data = php_driver_decimal_encoding(numeric, &size);
     CHECK_ERROR(cass_user_type_set_decimal_by_name(ut, name, data, size, numeric->data.decimal.scale));
-    free(data);
     break;
   case CASS_VALUE_TYPE_DURATION:
     duration = PHP_DRIVER_GET_DURATION(value);
@@ -704,6 +698,23 @@ php_driver_user_type_set(CassUserType *ut,
   return result;
 }
 
+/* Whether the encoding of values of this type can't change without the
+ * collection holding them being modified */
+static int
+php_driver_collection_reusable(php_driver_type *type)
+{
+  switch (type->type) {
+  case CASS_VALUE_TYPE_LIST:
+  case CASS_VALUE_TYPE_SET:
+  case CASS_VALUE_TYPE_MAP:
+  case CASS_VALUE_TYPE_TUPLE:
+  case CASS_VALUE_TYPE_UDT:
+    return 0;
+  default:
+    return 1;
+  }
+}
+
 int
 php_driver_collection_from_set(php_driver_set *set, CassCollection **collection_ptr TSRMLS_DC)
 {
@@ -715,6 +726,13 @@ php_driver_collection_from_set(php_driver_set *set, CassCollection **collection_
 
   type = PHP_DRIVER_GET_TYPE(PHP5TO7_ZVAL_MAYBE_P(set->type));
   value_type = PHP_DRIVER_GET_TYPE(PHP5TO7_ZVAL_MAYBE_P(type->data.set.value_type));
+
+  if (set->encoded && php_driver_collection_reusable(value_type)) {
+    *collection_ptr = set->encoded;
+    return 1;
+  }
+  PHP_DRIVER_CLEAR_ENCODED(set);
+
 #if CURRENT_CPP_DRIVER_VERSION > CPP_DRIVER_VERSION(2, 2, 2)
   collection = cass_collection_new_from_data_type(type->data_type,
                                                   HASH_COUNT(set->entries));
@@ -732,10 +750,12 @@ php_driver_collection_from_set(php_driver_set *set, CassCollection **collection_
     }
   }
 
-  if (result)
+  if (result) {
+    set->encoded = collection;
     *collection_ptr = collection;
-  else
+  } else {
     cass_collection_free(collection);
+  }
 
   return result;
 }
@@ -751,6 +771,13 @@ php_driver_collection_from_collection(php_driver_collection *coll, CassCollectio
 
   type = PHP_DRIVER_GET_TYPE(PHP5TO7_ZVAL_MAYBE_P(coll->type));
   value_type = PHP_DRIVER_GET_TYPE(PHP5TO7_ZVAL_MAYBE_P(type->data.collection.value_type));
+
+  if (coll->encoded && php_driver_collection_reusable(value_type)) {
+    *collection_ptr = coll->encoded;
+    return 1;
+  }
+  PHP_DRIVER_CLEAR_ENCODED(coll);
+
 #if CURRENT_CPP_DRIVER_VERSION > CPP_DRIVER_VERSION(2, 2, 2)
   collection = cass_collection_new_from_data_type(type->data_type,
                                                   zend_hash_num_elements(&coll->values));
@@ -767,10 +794,12 @@ php_driver_collection_from_collection(php_driver_collection *coll, CassCollectio
     }
   } PHP5TO7_ZEND_HASH_FOREACH_END(&coll->values);
 
-  if (result)
+  if (result) {
+    coll->encoded = collection;
     *collection_ptr = collection;
-  else
+  } else {
     cass_collection_free(collection);
+  }
 
   return result;
 }
@@ -788,6 +817,14 @@ php_driver_collection_from_map(php_driver_map *map, CassCollection **collection_
   type = PHP_DRIVER_GET_TYPE(PHP5TO7_ZVAL_MAYBE_P(map->type));
   value_type = PHP_DRIVER_GET_TYPE(PHP5TO7_ZVAL_MAYBE_P(type->data.map.value_type));
   key_type = PHP_DRIVER_GET_TYPE(PHP5TO7_ZVAL_MAYBE_P(type->data.map.key_type));
+
+  if (map->encoded && php_driver_collection_reusable(key_type) &&
+      php_driver_collection_reusable(value_type)) {
+    *collection_ptr = map->encoded;
+    return 1;
+  }
+  PHP_DRIVER_CLEAR_ENCODED(map);
+
 #if CURRENT_CPP_DRIVER_VERSION > CPP_DRIVER_VERSION(2, 2, 2)
   collection = cass_collection_new_from_data_type(type->data_type,
                                                   HASH_COUNT(map->entries));
@@ -811,10 +848,12 @@ php_driver_collection_from_map(php_driver_map *map, CassCollection **collection_
     }
   }
 
-  if (result)
+  if (result) {
+    map->encoded = collection;
     *collection_ptr = collection;
-  else
+  } else {
     cass_collection_free(collection);
+  }
 
   return result;
 }
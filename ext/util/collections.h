@@ -20,6 +20,19 @@
 int php_driver_validate_object(zval* object, zval* ztype TSRMLS_DC);
 int php_driver_value_type(char* type, CassValueType* value_type TSRMLS_DC);
 
+/* Appends a value whose type has been validated against the given one */
+int php_driver_collection_append(CassCollection *collection, zval *value, CassValueType type TSRMLS_DC);
+
+/* The encodings built from sets, lists and maps are owned by the value, which
+ * reuses them until it is modified when its elements are immutable */
+#define PHP_DRIVER_CLEAR_ENCODED(self) \
+  do { \
+    if ((self)->encoded) { \
+      cass_collection_free((self)->encoded); \
+      (self)->encoded = NULL; \
+    } \
+  } while (0)
+
 int php_driver_collection_from_set(php_driver_set* set, CassCollection** collection_ptr TSRMLS_DC);
 int php_driver_collection_from_collection(php_driver_collection* coll, CassCollection** collection_ptr TSRMLS_DC);
 int php_driver_collection_from_map(php_driver_map* map, CassCollection** collection_ptr TSRMLS_DC);
@@ -15,39 +15,294 @@
  */
 
 #include "php_driver.h"
+#include "php_driver_globals.h"
 #include "php_driver_types.h"
 #include "future.h"
+#include "util/ref.h"
 
-int
-php_driver_future_wait_timed(CassFuture *future, zval *timeout TSRMLS_DC)
+#include <uv.h>
+
+#ifndef _WIN32
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+/* Never destroyed, the driver's threads may still complete futures while the
+ * module shuts down */
+static uv_once_t completion_once = UV_ONCE_INIT;
+static uv_mutex_t completion_lock;
+static uv_cond_t completion_cond;
+static unsigned long completion_count = 0;
+
+#ifndef _WIN32
+/* Pipe written once on completions until it's cleared, so that event loops
+ * can poll its read end instead of blocking on futures */
+static int notification_fds[2] = { -1, -1 };
+static pid_t notification_pid = 0;
+static int notification_pending = 0;
+
+static void
+notification_signal()
 {
-  cass_duration_t timeout_us;
+  if (notification_fds[1] >= 0 && !notification_pending) {
+    notification_pending = 1;
+    if (write(notification_fds[1], "", 1) < 0) {
+      /* The pipe is non-blocking and holds at most one byte */
+    }
+  }
+}
+#endif
 
-  if (cass_future_ready(future)) return SUCCESS;
+static void
+completion_initialize()
+{
+  uv_mutex_init(&completion_lock);
+  uv_cond_init(&completion_cond);
+}
 
-#if PHP_MAJOR_VERSION >= 7
-  if (timeout == NULL ||
-      Z_TYPE_P(timeout) == IS_NULL ||
-      Z_TYPE_P(timeout) == IS_UNDEF) {
-#else
-  if (timeout == NULL || Z_TYPE_P(timeout) == IS_NULL) {
+static void
+completion_callback(CassFuture *future, void *data)
+{
+  uv_mutex_lock(&completion_lock);
+  completion_count++;
+  uv_cond_broadcast(&completion_cond);
+#ifndef _WIN32
+  notification_signal();
 #endif
+  uv_mutex_unlock(&completion_lock);
+}
 
-    cass_future_wait(future);
-  } else {
-    if ((Z_TYPE_P(timeout) == IS_LONG && Z_LVAL_P(timeout) > 0)) {
-      timeout_us = Z_LVAL_P(timeout) * 1000000;
-    } else if ((Z_TYPE_P(timeout) == IS_DOUBLE && Z_DVAL_P(timeout) > 0)) {
-      timeout_us = ceil(Z_DVAL_P(timeout) * 1000000);
+void
+php_driver_future_watch(CassFuture *future)
+{
+  uv_once(&completion_once, completion_initialize);
+
+  /* Fails when the future is already watched */
+  cass_future_set_callback(future, completion_callback, NULL);
+}
+
+unsigned long
+php_driver_future_completions()
+{
+  unsigned long completions;
+
+  uv_once(&completion_once, completion_initialize);
+
+  uv_mutex_lock(&completion_lock);
+  completions = completion_count;
+  uv_mutex_unlock(&completion_lock);
+
+  return completions;
+}
+
+int
+php_driver_future_wait_completion(unsigned long completions, uint64_t deadline)
+{
+  int rc = SUCCESS;
+
+  uv_once(&completion_once, completion_initialize);
+
+  uv_mutex_lock(&completion_lock);
+  while (completion_count == completions) {
+    uint64_t now;
+
+    if (!deadline) {
+      uv_cond_wait(&completion_cond, &completion_lock);
+      continue;
+    }
+
+    now = uv_hrtime();
+    if (now >= deadline ||
+        uv_cond_timedwait(&completion_cond, &completion_lock, deadline - now) != 0) {
+      rc = completion_count == completions ? FAILURE : SUCCESS;
+      break;
+    }
+  }
+  uv_mutex_unlock(&completion_lock);
+
+  return rc;
+}
+
+int
+php_driver_future_notification_fd()
+{
+#ifndef _WIN32
+  int fd;
+
+  uv_once(&completion_once, completion_initialize);
+
+  uv_mutex_lock(&completion_lock);
+  /* A forked process shares its parent's pipe */
+  if (notification_fds[0] >= 0 && notification_pid != getpid()) {
+    close(notification_fds[0]);
+    close(notification_fds[1]);
+    notification_fds[0] = notification_fds[1] = -1;
+  }
+
+  if (notification_fds[0] < 0) {
+    if (pipe(notification_fds) == 0) {
+      fcntl(notification_fds[0], F_SETFL, fcntl(notification_fds[0], F_GETFL) | O_NONBLOCK);
+      fcntl(notification_fds[1], F_SETFL, fcntl(notification_fds[1], F_GETFL) | O_NONBLOCK);
+      fcntl(notification_fds[0], F_SETFD, FD_CLOEXEC);
+      fcntl(notification_fds[1], F_SETFD, FD_CLOEXEC);
+      notification_pid = getpid();
+      notification_pending = 0;
     } else {
-      INVALID_ARGUMENT_VALUE(timeout, "an positive number of seconds or null", FAILURE);
+      notification_fds[0] = notification_fds[1] = -1;
     }
+  }
+  fd = notification_fds[0];
+  uv_mutex_unlock(&completion_lock);
+
+  return fd;
+#else
+  return -1;
+#endif
+}
 
-    if (!cass_future_wait_timed(future, timeout_us)) {
-      zend_throw_exception_ex(php_driver_timeout_exception_ce, 0 TSRMLS_CC,
-                              "Future hasn't resolved within %f seconds", timeout_us / 1000000.0);
-      return FAILURE;
+void
+php_driver_future_notify()
+{
+#ifndef _WIN32
+  uv_once(&completion_once, completion_initialize);
+
+  uv_mutex_lock(&completion_lock);
+  notification_signal();
+  uv_mutex_unlock(&completion_lock);
+#endif
+}
+
+void
+php_driver_future_clear_notification()
+{
+#ifndef _WIN32
+  char buf[16];
+
+  uv_once(&completion_once, completion_initialize);
+
+  uv_mutex_lock(&completion_lock);
+  if (notification_fds[0] >= 0 && notification_pid == getpid()) {
+    while (1) {
+      ssize_t n = read(notification_fds[0], buf, sizeof(buf));
+      if (n > 0 || (n < 0 && errno == EINTR)) continue;
+      break;
     }
+    notification_pending = 0;
+  }
+  uv_mutex_unlock(&completion_lock);
+#endif
+}
+
+CassFuture *
+php_driver_future_get(zval *future)
+{
+  zend_class_entry *ce = Z_OBJCE_P(future);
+
+  if (ce == php_driver_future_rows_ce)
+    return PHP_DRIVER_GET_FUTURE_ROWS(future)->future;
+  if (ce == php_driver_future_prepared_statement_ce)
+    return PHP_DRIVER_GET_FUTURE_PREPARED_STATEMENT(future)->future;
+  if (ce == php_driver_future_session_ce)
+    return PHP_DRIVER_GET_FUTURE_SESSION(future)->future;
+  if (ce == php_driver_future_close_ce)
+    return PHP_DRIVER_GET_FUTURE_CLOSE(future)->future;
+
+  return NULL;
+}
+
+int
+php_driver_future_timeout(zval *timeout, cass_duration_t *timeout_us TSRMLS_DC)
+{
+  if (timeout == NULL ||
+      Z_TYPE_P(timeout) == IS_NULL ||
+      Z_TYPE_P(timeout) == IS_UNDEF) {
+    *timeout_us = 0;
+  } else if ((Z_TYPE_P(timeout) == IS_LONG && Z_LVAL_P(timeout) > 0)) {
+    *timeout_us = Z_LVAL_P(timeout) * 1000000;
+  } else if ((Z_TYPE_P(timeout) == IS_DOUBLE && Z_DVAL_P(timeout) > 0)) {
+    *timeout_us = ceil(Z_DVAL_P(timeout) * 1000000);
+  } else {
+    INVALID_ARGUMENT_VALUE(timeout, "an positive number of seconds or null", FAILURE);
+  }
+
+  return SUCCESS;
+}
+
+uint64_t
+php_driver_future_deadline(cass_duration_t timeout_us)
+{
+  return timeout_us ? uv_hrtime() + (uint64_t) timeout_us * 1000 : 0;
+}
+
+int
+php_driver_future_check_deadline(uint64_t deadline TSRMLS_DC)
+{
+  if (deadline && uv_hrtime() >= deadline) {
+    zend_throw_exception_ex(php_driver_timeout_exception_ce, 0 TSRMLS_CC,
+                            "Deadline of the execution has passed");
+    return FAILURE;
+  }
+
+  return SUCCESS;
+}
+
+cass_uint64_t
+php_driver_future_request_timeout(zval *timeout, uint64_t deadline)
+{
+  cass_uint64_t timeout_ms = CASS_UINT64_MAX;
+
+  if (timeout && Z_TYPE_P(timeout) == IS_LONG && Z_LVAL_P(timeout) > 0) {
+    timeout_ms = (cass_uint64_t) Z_LVAL_P(timeout) * 1000;
+  } else if (timeout && Z_TYPE_P(timeout) == IS_DOUBLE && Z_DVAL_P(timeout) > 0) {
+    timeout_ms = ceil(Z_DVAL_P(timeout) * 1000);
+  }
+
+  if (deadline) {
+    uint64_t now = uv_hrtime();
+    /* At least a millisecond, 0 would disable the timeout */
+    cass_uint64_t remaining_ms = now < deadline ? (deadline - now + 999999) / 1000000 : 1;
+
+    if (remaining_ms < timeout_ms)
+      timeout_ms = remaining_ms;
+  }
+
+  return timeout_ms;
+}
+
+int
+php_driver_future_wait_timed(CassFuture *future, zval *timeout TSRMLS_DC)
+{
+  return php_driver_future_wait_deadline(future, timeout, 0 TSRMLS_CC);
+}
+
+int
+php_driver_future_wait_deadline(CassFuture *future, zval *timeout,
+                                uint64_t deadline TSRMLS_DC)
+{
+  cass_duration_t timeout_us;
+
+  if (cass_future_ready(future)) return SUCCESS;
+
+  if (php_driver_future_timeout(timeout, &timeout_us TSRMLS_CC) == FAILURE)
+    return FAILURE;
+
+  if (deadline) {
+    uint64_t now = uv_hrtime();
+
+    if (now >= deadline)
+      return php_driver_future_check_deadline(deadline TSRMLS_CC);
+
+    if (!timeout_us || (deadline - now) / 1000 < (uint64_t) timeout_us)
+      timeout_us = (deadline - now + 999) / 1000;
+  }
+
+  if (!timeout_us) {
+    cass_future_wait(future);
+  } else if (!cass_future_wait_timed(future, timeout_us)) {
+    zend_throw_exception_ex(php_driver_timeout_exception_ce, 0 TSRMLS_CC,
+                            "Future hasn't resolved within %f seconds", timeout_us / 1000000.0);
+    return FAILURE;
   }
 
   return SUCCESS;
@@ -67,3 +322,71 @@ php_driver_future_is_error(CassFuture *future TSRMLS_DC)
   }
   return SUCCESS;
 }
+
+typedef struct {
+  CassFuture *future;
+  php_driver_ref *statement;
+} released_future;
+
+static void
+released_future_free(zval *zv)
+{
+  released_future *released = (released_future *) Z_PTR_P(zv);
+
+  cass_future_free(released->future);
+  php_driver_del_ref(&released->statement);
+  efree(released);
+}
+
+void
+php_driver_future_release(CassFuture *future, php_driver_ref *statement TSRMLS_DC)
+{
+  released_future *released;
+
+  if (!statement || cass_future_ready(future)) {
+    cass_future_free(future);
+    return;
+  }
+
+  php_driver_future_collect(TSRMLS_C);
+
+  if (!PHP_DRIVER_G(released_futures)) {
+    ALLOC_HASHTABLE(PHP_DRIVER_G(released_futures));
+    zend_hash_init(PHP_DRIVER_G(released_futures), 0, NULL, released_future_free, 0);
+  }
+
+  released = (released_future *) emalloc(sizeof(released_future));
+  released->future    = future;
+  released->statement = php_driver_add_ref(statement);
+  zend_hash_next_index_insert_ptr(PHP_DRIVER_G(released_futures), released);
+}
+
+void
+php_driver_future_collect(TSRMLS_D)
+{
+  HashTable *futures = PHP_DRIVER_G(released_futures);
+  released_future *released;
+  zend_ulong index;
+
+  if (!futures)
+    return;
+
+  ZEND_HASH_FOREACH_NUM_KEY_PTR(futures, index, released) {
+    if (cass_future_ready(released->future))
+      zend_hash_index_del(futures, index);
+  } ZEND_HASH_FOREACH_END();
+}
+
+void
+php_driver_future_destroy(TSRMLS_D)
+{
+  if (PHP_DRIVER_G(released_futures)) {
+    HashTable *futures = PHP_DRIVER_G(released_futures);
+
+    /* The driver holds its own reference to the statements of the requests
+     * still running */
+    PHP_DRIVER_G(released_futures) = NULL;
+    zend_hash_destroy(futures);
+    FREE_HASHTABLE(futures);
+  }
+}
@@ -20,4 +20,46 @@
 int  php_driver_future_wait_timed(CassFuture *future, zval *timeout TSRMLS_DC);
 int  php_driver_future_is_error(CassFuture *future TSRMLS_DC);
 
+/* Deadlines are from uv_hrtime(), 0 for none */
+uint64_t php_driver_future_deadline(cass_duration_t timeout_us);
+int  php_driver_future_check_deadline(uint64_t deadline TSRMLS_DC);
+
+/* Waits until the timeout or the deadline passes, whichever comes first */
+int  php_driver_future_wait_deadline(CassFuture *future, zval *timeout,
+                                     uint64_t deadline TSRMLS_DC);
+
+/* Returns the request timeout in milliseconds of a statement waited for
+ * with the timeout and deadline, CASS_UINT64_MAX to use the cluster's */
+cass_uint64_t php_driver_future_request_timeout(zval *timeout, uint64_t deadline);
+
+/* Converts a timeout in seconds to microseconds, 0 when it is null */
+int  php_driver_future_timeout(zval *timeout, cass_duration_t *timeout_us TSRMLS_DC);
+
+/* Counts the completion of a future, the driver only runs one callback per
+ * future so futures are watched by every waiter through this count */
+void php_driver_future_watch(CassFuture *future);
+unsigned long php_driver_future_completions();
+
+/* Waits until a future completes after the given count of completions or
+ * until the deadline (from uv_hrtime(), 0 for none) passes */
+int  php_driver_future_wait_completion(unsigned long completions, uint64_t deadline);
+
+/* Returns the read end of a pipe that becomes readable when a watched future
+ * completes, -1 when it can't be created or on Windows */
+int  php_driver_future_notification_fd();
+void php_driver_future_notify();
+void php_driver_future_clear_notification();
+
+/* Returns the driver's future behind a future, NULL when it's already
+ * resolved or isn't one of the driver's */
+CassFuture *php_driver_future_get(zval *future);
+
+/* Frees the future of an execution. The driver still reads the statement
+ * until the request completes, when it hasn't yet the statement is kept
+ * referenced so that it isn't modified in place in the meantime */
+void php_driver_future_release(CassFuture *future, php_driver_ref *statement TSRMLS_DC);
+/* Drops the futures released earlier whose requests have completed */
+void php_driver_future_collect(TSRMLS_D);
+void php_driver_future_destroy(TSRMLS_D);
+
 #endif /* PHP_DRIVER_UTIL_FUTURE_H */
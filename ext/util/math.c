@@ -613,3 +613,27 @@ export_twos_complement(mpz_t number, size_t *size)
 
   return bytes;
 }
+
+const cass_byte_t *
+php_driver_varint_encoding(php_driver_numeric *varint, size_t *size)
+{
+  if (!varint->data.varint.encoded) {
+    varint->data.varint.encoded =
+        export_twos_complement(varint->data.varint.value, &varint->data.varint.encoded_size);
+  }
+
+  *size = varint->data.varint.encoded_size;
+  return varint->data.varint.encoded;
+}
+
+const cass_byte_t *
+php_driver_decimal_encoding(php_driver_numeric *decimal, size_t *size)
+{
+  if (!decimal->data.decimal.encoded) {
+    decimal->data.decimal.encoded =
+        export_twos_complement(decimal->data.decimal.value, &decimal->data.decimal.encoded_size);
+  }
+
+  *size = decimal->data.decimal.encoded_size;
+  return decimal->data.decimal.encoded;
+}
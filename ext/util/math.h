@@ -20,6 +20,11 @@
 void import_twos_complement(cass_byte_t *data, size_t size, mpz_t *number);
 cass_byte_t *export_twos_complement(mpz_t number, size_t *size);
 
+/* Two's complement encodings of varints and decimals, which are computed the
+ * first time they're needed and kept by the value */
+const cass_byte_t *php_driver_varint_encoding(php_driver_numeric *varint, size_t *size);
+const cass_byte_t *php_driver_decimal_encoding(php_driver_numeric *decimal, size_t *size);
+
 int php_driver_parse_float(char *in, int in_len, cass_float_t *number TSRMLS_DC);
 int php_driver_parse_double(char* in, int in_len, cass_double_t* number TSRMLS_DC);
 int php_driver_parse_int(char* in, int in_len, cass_int32_t* number TSRMLS_DC);
@@ -0,0 +1,313 @@
+/**
+ * Copyright 2017 DataStax, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "php_driver.h"
+#include "php_driver_types.h"
+#include "util/prepared_cache.h"
+#include "util/ref.h"
+
+#include <ctype.h>
+
+/* If TSRM is enabled then the last thread to update this wins */
+static zend_long prepared_cache_size = 0;
+
+typedef struct prepared_entry_ prepared_entry;
+
+struct prepared_entry_ {
+  zend_string *key;
+  CassFuture *future;
+  prepared_entry *prev;
+  prepared_entry *next;
+};
+
+/* Executions of a query the application didn't prepare */
+typedef struct {
+  zend_long count;
+  CassFuture *future;
+  int failed;
+} execution_count;
+
+/* Entries are linked from the most to the least recently used */
+typedef struct {
+  HashTable entries;
+  prepared_entry *head;
+  prepared_entry *tail;
+  HashTable counts;
+  char *keyspace;
+} prepared_cache;
+
+PHP_INI_MH(OnUpdatePreparedCacheSize)
+{
+  zend_long size = new_value ? ZEND_STRTOL(ZSTR_VAL(new_value), NULL, 10) : 0;
+
+  if (size < 0) {
+    php_error_docref(NULL, E_NOTICE,
+                     PHP_DRIVER_NAME " | Invalid prepared cache size '%s', disabling it",
+                     ZSTR_VAL(new_value));
+    size = 0;
+  }
+  prepared_cache_size = size;
+
+  return SUCCESS;
+}
+
+static void
+unlink_entry(prepared_cache *cache, prepared_entry *entry)
+{
+  if (entry->prev)
+    entry->prev->next = entry->next;
+  else
+    cache->head = entry->next;
+
+  if (entry->next)
+    entry->next->prev = entry->prev;
+  else
+    cache->tail = entry->prev;
+
+  entry->prev = entry->next = NULL;
+}
+
+static void
+link_entry(prepared_cache *cache, prepared_entry *entry)
+{
+  entry->prev = NULL;
+  entry->next = cache->head;
+
+  if (cache->head)
+    cache->head->prev = entry;
+  else
+    cache->tail = entry;
+
+  cache->head = entry;
+}
+
+static void
+free_entry(prepared_entry *entry)
+{
+  cass_future_free(entry->future);
+  zend_string_release(entry->key);
+  pefree(entry, 1);
+}
+
+static void
+free_execution_count(zval *zv)
+{
+  execution_count *counter = (execution_count *) Z_PTR_P(zv);
+
+  if (counter->future)
+    cass_future_free(counter->future);
+  pefree(counter, 1);
+}
+
+static void
+free_prepared_cache(void *data)
+{
+  prepared_cache *cache = (prepared_cache *) data;
+  prepared_entry *entry = cache->head;
+
+  while (entry) {
+    prepared_entry *next = entry->next;
+    free_entry(entry);
+    entry = next;
+  }
+
+  zend_hash_destroy(&cache->entries);
+  zend_hash_destroy(&cache->counts);
+  if (cache->keyspace)
+    pefree(cache->keyspace, 1);
+  pefree(cache, 1);
+}
+
+php_driver_ref *
+php_driver_prepared_cache_new(const char *keyspace)
+{
+  prepared_cache *cache;
+
+  if (prepared_cache_size <= 0)
+    return NULL;
+
+  cache = (prepared_cache *) pecalloc(1, sizeof(prepared_cache), 1);
+  zend_hash_init(&cache->entries, 0, NULL, NULL, 1);
+  zend_hash_init(&cache->counts, 0, NULL, free_execution_count, 1);
+  cache->keyspace = keyspace ? pestrdup(keyspace, 1) : NULL;
+
+  return php_driver_new_peref(cache, free_prepared_cache, 1);
+}
+
+zend_string *
+php_driver_prepared_cache_key(php_driver_ref *cache_ref,
+                              const char *cql, size_t cql_len)
+{
+  prepared_cache *cache = (prepared_cache *) cache_ref->data;
+  size_t keyspace_len = cache->keyspace ? strlen(cache->keyspace) : 0;
+  zend_string *key = zend_string_alloc(keyspace_len + 1 + cql_len, 0);
+
+  /* Keyspaces can't contain NUL characters */
+  if (keyspace_len)
+    memcpy(ZSTR_VAL(key), cache->keyspace, keyspace_len);
+  ZSTR_VAL(key)[keyspace_len] = '\0';
+  memcpy(ZSTR_VAL(key) + keyspace_len + 1, cql, cql_len);
+  ZSTR_VAL(key)[ZSTR_LEN(key)] = '\0';
+
+  return key;
+}
+
+const CassPrepared *
+php_driver_prepared_cache_find(php_driver_ref *cache_ref, zend_string *key)
+{
+  prepared_cache *cache = (prepared_cache *) cache_ref->data;
+  prepared_entry *entry = (prepared_entry *) zend_hash_find_ptr(&cache->entries, key);
+
+  if (!entry)
+    return NULL;
+
+  unlink_entry(cache, entry);
+  link_entry(cache, entry);
+
+  /* Each call returns a new prepared statement owned by the caller */
+  return cass_future_get_prepared(entry->future);
+}
+
+void
+php_driver_prepared_cache_add(php_driver_ref *cache_ref, zend_string *key,
+                              CassFuture *future)
+{
+  prepared_cache *cache = (prepared_cache *) cache_ref->data;
+  prepared_entry *entry;
+
+  /* Prepared concurrently, keep the first one */
+  if (zend_hash_exists(&cache->entries, key)) {
+    cass_future_free(future);
+    return;
+  }
+
+  entry = (prepared_entry *) pecalloc(1, sizeof(prepared_entry), 1);
+  entry->key    = zend_string_dup(key, 1);
+  entry->future = future;
+
+  zend_hash_add_ptr(&cache->entries, entry->key, entry);
+  link_entry(cache, entry);
+
+  while (prepared_cache_size > 0 &&
+         zend_hash_num_elements(&cache->entries) > (uint32_t) prepared_cache_size) {
+    prepared_entry *last = cache->tail;
+
+    unlink_entry(cache, last);
+    zend_hash_del(&cache->entries, last->key);
+    free_entry(last);
+  }
+}
+
+const CassPrepared *
+php_driver_prepared_cache_auto(php_driver_ref *cache_ref, CassSession *session,
+                               zend_string *key, const char *cql, size_t cql_len,
+                               int threshold)
+{
+  prepared_cache *cache = (prepared_cache *) cache_ref->data;
+  const CassPrepared *prepared = php_driver_prepared_cache_find(cache_ref, key);
+  execution_count *counter;
+
+  if (prepared)
+    return prepared;
+
+  counter = (execution_count *) zend_hash_find_ptr(&cache->counts, key);
+  if (!counter) {
+    zend_string *persistent_key;
+
+    /* Queries built with their values are never the same, start over
+     * rather than counting them forever */
+    if (zend_hash_num_elements(&cache->counts) >= (uint32_t) MAX(prepared_cache_size, 1))
+      zend_hash_clean(&cache->counts);
+
+    counter = (execution_count *) pecalloc(1, sizeof(execution_count), 1);
+    persistent_key = zend_string_dup(key, 1);
+    zend_hash_add_ptr(&cache->counts, persistent_key, counter);
+    zend_string_release(persistent_key);
+  }
+
+  if (counter->failed)
+    return NULL;
+
+  if (counter->future) {
+    CassFuture *future = counter->future;
+
+    if (!cass_future_ready(future))
+      return NULL;
+
+    counter->future = NULL;
+    if (cass_future_error_code(future) != CASS_OK) {
+      cass_future_free(future);
+      counter->failed = 1;
+      return NULL;
+    }
+
+    zend_hash_del(&cache->counts, key);
+    php_driver_prepared_cache_add(cache_ref, key, future);
+    return php_driver_prepared_cache_find(cache_ref, key);
+  }
+
+  /* Prepared in the background, executions keep going unprepared until
+   * it's done */
+  if (++counter->count >= threshold)
+    counter->future = cass_session_prepare_n(session, cql, cql_len);
+
+  return NULL;
+}
+
+int
+php_driver_prepared_cache_parse_use(const char *cql, size_t cql_len,
+                                    const char **keyspace, size_t *keyspace_len)
+{
+  const char *end = cql + cql_len;
+  const char *name;
+
+  while (cql < end && isspace((unsigned char) *cql)) cql++;
+
+  if (end - cql < 4 ||
+      strncasecmp(cql, "use", 3) != 0 ||
+      !isspace((unsigned char) cql[3]))
+    return 0;
+
+  name = cql + 3;
+  while (name < end && isspace((unsigned char) *name)) name++;
+  while (end > name && (isspace((unsigned char) end[-1]) || end[-1] == ';')) end--;
+
+  if (end == name)
+    return 0;
+
+  *keyspace     = name;
+  *keyspace_len = end - name;
+
+  return 1;
+}
+
+void
+php_driver_prepared_cache_use(php_driver_ref *cache_ref,
+                              const char *keyspace, size_t keyspace_len)
+{
+  prepared_cache *cache = (prepared_cache *) cache_ref->data;
+  size_t i;
+
+  if (cache->keyspace)
+    pefree(cache->keyspace, 1);
+  cache->keyspace = pestrndup(keyspace, keyspace_len, 1);
+
+  /* Unquoted names are case insensitive */
+  if (cache->keyspace[0] != '"') {
+    for (i = 0; i < keyspace_len; i++)
+      cache->keyspace[i] = tolower((unsigned char) cache->keyspace[i]);
+  }
+}
@@ -0,0 +1,57 @@
+/**
+ * Copyright 2015-2017 DataStax, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PHP_DRIVER_PREPARED_CACHE_H
+#define PHP_DRIVER_PREPARED_CACHE_H
+
+/* Prepared statements of a persistent session, kept in persistent memory so
+ * that they're reused across requests. Returns NULL when the cache is
+ * disabled */
+php_driver_ref *php_driver_prepared_cache_new(const char *keyspace);
+
+/* Returns the key of a query in the session's current keyspace */
+zend_string *php_driver_prepared_cache_key(php_driver_ref *cache,
+                                           const char *cql, size_t cql_len);
+
+/* Returns a new prepared statement when the query was already prepared, or
+ * NULL */
+const CassPrepared *php_driver_prepared_cache_find(php_driver_ref *cache,
+                                                   zend_string *key);
+
+/* Takes ownership of the successful future of a prepared query, evicting
+ * the least recently used queries past the cache's size */
+void php_driver_prepared_cache_add(php_driver_ref *cache, zend_string *key,
+                                   CassFuture *future);
+
+/* Counts the executions of a query the application didn't prepare and
+ * prepares it in the background once it's executed `threshold` times.
+ * Returns a new prepared statement once it's ready, or NULL */
+const CassPrepared *php_driver_prepared_cache_auto(php_driver_ref *cache,
+                                                   CassSession *session,
+                                                   zend_string *key,
+                                                   const char *cql, size_t cql_len,
+                                                   int threshold);
+
+/* Returns 1 for USE queries along with the keyspace they switch to */
+int  php_driver_prepared_cache_parse_use(const char *cql, size_t cql_len,
+                                         const char **keyspace, size_t *keyspace_len);
+
+/* Keys the queries prepared afterwards by the keyspace a USE query switched
+ * the session to, once it succeeded */
+void php_driver_prepared_cache_use(php_driver_ref *cache,
+                                   const char *keyspace, size_t keyspace_len);
+
+#endif /* PHP_DRIVER_PREPARED_CACHE_H */
@@ -18,481 +18,1385 @@
 #include "php_driver_types.h"
 #include "result.h"
 #include "math.h"
+#include "inet.h"
 #include "collections.h"
 #include "types.h"
+#include "ref.h"
+#include "src/Blob.h"
 #include "src/Collection.h"
 #include "src/Map.h"
 #include "src/Set.h"
 #include "src/Tuple.h"
 #include "src/UserTypeValue.h"
 
-int
-php_driver_value(const CassValue* value, const CassDataType* data_type, php5to7_zval *out TSRMLS_DC)
+/* Per-type decoders. Each one is only ever called with a non-null value; the
+ * null check happens once in php_driver_decode(). */
+
+static int
+decode_null(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
+{
+  ZVAL_NULL(PHP5TO7_ZVAL_MAYBE_DEREF(out));
+  return SUCCESS;
+}
+
+static int
+decode_text(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
 {
   const char *v_string;
   size_t v_string_len;
+
+  ASSERT_SUCCESS_BLOCK(cass_value_get_string(value, &v_string, &v_string_len),
+    return FAILURE;
+  );
+  PHP5TO7_ZVAL_STRINGL(PHP5TO7_ZVAL_MAYBE_DEREF(out), v_string, v_string_len);
+  return SUCCESS;
+}
+
+static int
+decode_int(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
+{
+  cass_int32_t v_int_32;
+
+  ASSERT_SUCCESS_BLOCK(cass_value_get_int32(value, &v_int_32),
+    return FAILURE;
+  );
+  ZVAL_LONG(PHP5TO7_ZVAL_MAYBE_DEREF(out), v_int_32);
+  return SUCCESS;
+}
+
+static int
+decode_boolean(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
+{
+  cass_bool_t v_boolean;
+
+  ASSERT_SUCCESS_BLOCK(cass_value_get_bool(value, &v_boolean),
+    return FAILURE;
+  );
+  if (v_boolean) {
+    ZVAL_TRUE(PHP5TO7_ZVAL_MAYBE_DEREF(out));
+  } else {
+    ZVAL_FALSE(PHP5TO7_ZVAL_MAYBE_DEREF(out));
+  }
+  return SUCCESS;
+}
+
+static int
+decode_double(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
+{
+  cass_double_t v_double;
+
+  ASSERT_SUCCESS_BLOCK(cass_value_get_double(value, &v_double),
+    return FAILURE;
+  );
+  ZVAL_DOUBLE(PHP5TO7_ZVAL_MAYBE_DEREF(out), v_double);
+  return SUCCESS;
+}
+
+static int
+decode_bigint(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
+{
+  php_driver_numeric *numeric;
+
+  object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_bigint_ce);
+  numeric = PHP_DRIVER_GET_NUMERIC(PHP5TO7_ZVAL_MAYBE_DEREF(out));
+  ASSERT_SUCCESS_BLOCK(cass_value_get_int64(value, &numeric->data.bigint.value),
+    zval_ptr_dtor(out);
+    return FAILURE;
+  )
+  return SUCCESS;
+}
+
+static int
+decode_smallint(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
+{
+  php_driver_numeric *numeric;
+
+  object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_smallint_ce);
+  numeric = PHP_DRIVER_GET_NUMERIC(PHP5TO7_ZVAL_MAYBE_DEREF(out));
+  ASSERT_SUCCESS_BLOCK(cass_value_get_int16(value, &numeric->data.smallint.value),
+    zval_ptr_dtor(out);
+    return FAILURE;
+  )
+  return SUCCESS;
+}
+
+static int
+decode_tinyint(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
+{
+  php_driver_numeric *numeric;
+
+  object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_tinyint_ce);
+  numeric = PHP_DRIVER_GET_NUMERIC(PHP5TO7_ZVAL_MAYBE_DEREF(out));
+  ASSERT_SUCCESS_BLOCK(cass_value_get_int8(value, &numeric->data.tinyint.value),
+    zval_ptr_dtor(out);
+    return FAILURE;
+  )
+  return SUCCESS;
+}
+
+static int
+decode_float(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
+{
+  php_driver_numeric *numeric;
+
+  object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_float_ce);
+  numeric = PHP_DRIVER_GET_NUMERIC(PHP5TO7_ZVAL_MAYBE_DEREF(out));
+  ASSERT_SUCCESS_BLOCK(cass_value_get_float(value, &numeric->data.floating.value),
+    zval_ptr_dtor(out);
+    return FAILURE;
+  )
+  return SUCCESS;
+}
+
+static int
+decode_varint(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
+{
   const cass_byte_t *v_bytes;
   size_t v_bytes_len;
+  php_driver_numeric *numeric;
+
+  object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_varint_ce);
+  numeric = PHP_DRIVER_GET_NUMERIC(PHP5TO7_ZVAL_MAYBE_DEREF(out));
+  ASSERT_SUCCESS_BLOCK(cass_value_get_bytes(value, &v_bytes, &v_bytes_len),
+    zval_ptr_dtor(out);
+    return FAILURE;
+  );
+  import_twos_complement((cass_byte_t*) v_bytes, v_bytes_len, &numeric->data.varint.value);
+  return SUCCESS;
+}
+
+static int
+decode_decimal(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
+{
   const cass_byte_t *v_decimal;
   size_t v_decimal_len;
   cass_int32_t v_decimal_scale;
-  cass_int32_t v_int_32;
-  cass_bool_t v_boolean;
-  cass_double_t v_double;
+  php_driver_numeric *numeric;
+
+  object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_decimal_ce);
+  numeric = PHP_DRIVER_GET_NUMERIC(PHP5TO7_ZVAL_MAYBE_DEREF(out));
+  ASSERT_SUCCESS_BLOCK(cass_value_get_decimal(value, &v_decimal, &v_decimal_len, &v_decimal_scale),
+    zval_ptr_dtor(out);
+    return FAILURE;
+  );
+  import_twos_complement((cass_byte_t*) v_decimal, v_decimal_len, &numeric->data.decimal.value);
+  numeric->data.decimal.scale = v_decimal_scale;
+  return SUCCESS;
+}
+
+static int
+decode_timestamp(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
+{
+  php_driver_timestamp *timestamp;
+
+  object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_timestamp_ce);
+  timestamp = PHP_DRIVER_GET_TIMESTAMP(PHP5TO7_ZVAL_MAYBE_DEREF(out));
+  ASSERT_SUCCESS_BLOCK(cass_value_get_int64(value, &timestamp->timestamp),
+    zval_ptr_dtor(out);
+    return FAILURE;
+  )
+  return SUCCESS;
+}
+
+static int
+decode_date(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
+{
+  php_driver_date *date;
+
+  object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_date_ce);
+  date = PHP_DRIVER_GET_DATE(PHP5TO7_ZVAL_MAYBE_DEREF(out));
+  ASSERT_SUCCESS_BLOCK(cass_value_get_uint32(value, &date->date),
+    zval_ptr_dtor(out);
+    return FAILURE;
+  )
+  return SUCCESS;
+}
+
+static int
+decode_time(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
+{
+  php_driver_time *time;
+
+  object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_time_ce);
+  time = PHP_DRIVER_GET_TIME(PHP5TO7_ZVAL_MAYBE_DEREF(out));
+  ASSERT_SUCCESS_BLOCK(cass_value_get_int64(value, &time->time),
+    zval_ptr_dtor(out);
+    return FAILURE;
+  )
+  return SUCCESS;
+}
+
+static int
+decode_blob(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
+{
+  const cass_byte_t *v_bytes;
+  size_t v_bytes_len;
+  php_driver_blob *blob;
+
+  object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_blob_ce);
+  blob = PHP_DRIVER_GET_BLOB(PHP5TO7_ZVAL_MAYBE_DEREF(out));
+  ASSERT_SUCCESS_BLOCK(cass_value_get_bytes(value, &v_bytes, &v_bytes_len),
+    zval_ptr_dtor(out);
+    return FAILURE;
+  )
+  php_driver_blob_set(blob, v_bytes, v_bytes_len);
+  return SUCCESS;
+}
+
+static int
+decode_uuid(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
+{
+  php_driver_uuid *uuid;
+
+  object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_uuid_ce);
+  uuid = PHP_DRIVER_GET_UUID(PHP5TO7_ZVAL_MAYBE_DEREF(out));
+  ASSERT_SUCCESS_BLOCK(cass_value_get_uuid(value, &uuid->uuid),
+    zval_ptr_dtor(out);
+    return FAILURE;
+  )
+  return SUCCESS;
+}
+
+static int
+decode_timeuuid(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
+{
   php_driver_uuid *uuid;
+
+  object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_timeuuid_ce);
+  uuid = PHP_DRIVER_GET_UUID(PHP5TO7_ZVAL_MAYBE_DEREF(out));
+  ASSERT_SUCCESS_BLOCK(cass_value_get_uuid(value, &uuid->uuid),
+    zval_ptr_dtor(out);
+    return FAILURE;
+  )
+  return SUCCESS;
+}
+
+static int
+decode_inet(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
+{
+  php_driver_inet *inet;
+
+  object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_inet_ce);
+  inet = PHP_DRIVER_GET_INET(PHP5TO7_ZVAL_MAYBE_DEREF(out));
+  ASSERT_SUCCESS_BLOCK(cass_value_get_inet(value, &inet->inet),
+    zval_ptr_dtor(out);
+    return FAILURE;
+  )
+  return SUCCESS;
+}
+
+/* Native decoders, used instead of the ones above when a result is decoded
+ * with native types: they return plain PHP scalars rather than wrapper
+ * objects. */
+
+static int
+decode_native_bigint(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
+{
+  cass_int64_t v_int_64;
+
+  ASSERT_SUCCESS_BLOCK(cass_value_get_int64(value, &v_int_64),
+    return FAILURE;
+  );
+  ZVAL_LONG(PHP5TO7_ZVAL_MAYBE_DEREF(out), (php5to7_long) v_int_64);
+  return SUCCESS;
+}
+
+static int
+decode_native_smallint(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
+{
+  cass_int16_t v_int_16;
+
+  ASSERT_SUCCESS_BLOCK(cass_value_get_int16(value, &v_int_16),
+    return FAILURE;
+  );
+  ZVAL_LONG(PHP5TO7_ZVAL_MAYBE_DEREF(out), v_int_16);
+  return SUCCESS;
+}
+
+static int
+decode_native_tinyint(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
+{
+  cass_int8_t v_int_8;
+
+  ASSERT_SUCCESS_BLOCK(cass_value_get_int8(value, &v_int_8),
+    return FAILURE;
+  );
+  ZVAL_LONG(PHP5TO7_ZVAL_MAYBE_DEREF(out), v_int_8);
+  return SUCCESS;
+}
+
+static int
+decode_native_float(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
+{
+  cass_float_t v_float;
+
+  ASSERT_SUCCESS_BLOCK(cass_value_get_float(value, &v_float),
+    return FAILURE;
+  );
+  ZVAL_DOUBLE(PHP5TO7_ZVAL_MAYBE_DEREF(out), v_float);
+  return SUCCESS;
+}
+
+static int
+decode_native_date(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
+{
+  cass_uint32_t v_date;
+
+  ASSERT_SUCCESS_BLOCK(cass_value_get_uint32(value, &v_date),
+    return FAILURE;
+  );
+  ZVAL_LONG(PHP5TO7_ZVAL_MAYBE_DEREF(out), (php5to7_long) cass_date_time_to_epoch(v_date, 0));
+  return SUCCESS;
+}
+
+static int
+decode_native_uuid(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
+{
+  CassUuid v_uuid;
+  char string[CASS_UUID_STRING_LENGTH];
+
+  ASSERT_SUCCESS_BLOCK(cass_value_get_uuid(value, &v_uuid),
+    return FAILURE;
+  );
+  cass_uuid_string(v_uuid, string);
+  PHP5TO7_ZVAL_STRING(PHP5TO7_ZVAL_MAYBE_DEREF(out), string);
+  return SUCCESS;
+}
+
+static int
+decode_native_inet(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
+{
+  CassInet v_inet;
+  char *string;
+
+  ASSERT_SUCCESS_BLOCK(cass_value_get_inet(value, &v_inet),
+    return FAILURE;
+  );
+  php_driver_format_address(v_inet, &string);
+  PHP5TO7_ZVAL_STRING(PHP5TO7_ZVAL_MAYBE_DEREF(out), string);
+  efree(string);
+  return SUCCESS;
+}
+
+static int
+decode_duration(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
+{
+  php_driver_duration *duration;
+
+  object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_duration_ce);
+  duration = PHP_DRIVER_GET_DURATION(PHP5TO7_ZVAL_MAYBE_DEREF(out));
+  ASSERT_SUCCESS_BLOCK(cass_value_get_duration(value, &duration->months, &duration->days, &duration->nanos),
+    zval_ptr_dtor(out);
+    return FAILURE;
+  );
+  return SUCCESS;
+}
+
+static int
+decode_list(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
+{
+  CassIterator *iterator;
+  php_driver_collection *collection;
+
+  object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_collection_ce);
+  collection = PHP_DRIVER_GET_COLLECTION(PHP5TO7_ZVAL_MAYBE_DEREF(out));
+  PHP5TO7_ZVAL_COPY(PHP5TO7_ZVAL_MAYBE_P(collection->type),
+                    PHP5TO7_ZVAL_MAYBE_P(decoder->type));
+
+  iterator = cass_iterator_from_collection(value);
+
+  while (cass_iterator_next(iterator)) {
+    php5to7_zval v;
+
+    if (php_driver_decode(cass_iterator_get_value(iterator),
+                          &decoder->sub_decoders[0], &v TSRMLS_CC) == FAILURE) {
+      cass_iterator_free(iterator);
+      zval_ptr_dtor(out);
+      return FAILURE;
+    }
+
+    php_driver_collection_add(collection, PHP5TO7_ZVAL_MAYBE_P(v) TSRMLS_CC);
+    zval_ptr_dtor(&v);
+  }
+
+  cass_iterator_free(iterator);
+  return SUCCESS;
+}
+
+static int
+decode_map(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
+{
+  CassIterator *iterator;
+  php_driver_map *map;
+
+  object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_map_ce);
+  map = PHP_DRIVER_GET_MAP(PHP5TO7_ZVAL_MAYBE_DEREF(out));
+  PHP5TO7_ZVAL_COPY(PHP5TO7_ZVAL_MAYBE_P(map->type),
+                    PHP5TO7_ZVAL_MAYBE_P(decoder->type));
+
+  iterator = cass_iterator_from_map(value);
+
+  while (cass_iterator_next(iterator)) {
+    php5to7_zval k;
+    php5to7_zval v;
+
+    if (php_driver_decode(cass_iterator_get_map_key(iterator),
+                          &decoder->sub_decoders[0], &k TSRMLS_CC) == FAILURE) {
+      cass_iterator_free(iterator);
+      zval_ptr_dtor(out);
+      return FAILURE;
+    }
+
+    if (php_driver_decode(cass_iterator_get_map_value(iterator),
+                          &decoder->sub_decoders[1], &v TSRMLS_CC) == FAILURE) {
+      zval_ptr_dtor(&k);
+      cass_iterator_free(iterator);
+      zval_ptr_dtor(out);
+      return FAILURE;
+    }
+
+    php_driver_map_set(map, PHP5TO7_ZVAL_MAYBE_P(k), PHP5TO7_ZVAL_MAYBE_P(v) TSRMLS_CC);
+    zval_ptr_dtor(&k);
+    zval_ptr_dtor(&v);
+  }
+
+  cass_iterator_free(iterator);
+  return SUCCESS;
+}
+
+static int
+decode_set(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
+{
+  CassIterator *iterator;
+  php_driver_set *set;
+
+  object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_set_ce);
+  set = PHP_DRIVER_GET_SET(PHP5TO7_ZVAL_MAYBE_DEREF(out));
+  PHP5TO7_ZVAL_COPY(PHP5TO7_ZVAL_MAYBE_P(set->type),
+                    PHP5TO7_ZVAL_MAYBE_P(decoder->type));
+
+  iterator = cass_iterator_from_collection(value);
+
+  while (cass_iterator_next(iterator)) {
+    php5to7_zval v;
+
+    if (php_driver_decode(cass_iterator_get_value(iterator),
+                          &decoder->sub_decoders[0], &v TSRMLS_CC) == FAILURE) {
+      cass_iterator_free(iterator);
+      zval_ptr_dtor(out);
+      return FAILURE;
+    }
+
+    php_driver_set_add(set, PHP5TO7_ZVAL_MAYBE_P(v) TSRMLS_CC);
+    zval_ptr_dtor(&v);
+  }
+
+  cass_iterator_free(iterator);
+  return SUCCESS;
+}
+
+static int
+decode_tuple(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
+{
+  CassIterator *iterator;
+  php_driver_tuple *tuple;
+  ulong index;
+
+  object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_tuple_ce);
+  tuple = PHP_DRIVER_GET_TUPLE(PHP5TO7_ZVAL_MAYBE_DEREF(out));
+  PHP5TO7_ZVAL_COPY(PHP5TO7_ZVAL_MAYBE_P(tuple->type),
+                    PHP5TO7_ZVAL_MAYBE_P(decoder->type));
+
+  iterator = cass_iterator_from_tuple(value);
+
+  index = 0;
+  while (cass_iterator_next(iterator) && index < decoder->sub_count) {
+    const CassValue* value = cass_iterator_get_value(iterator);
+
+    if (!cass_value_is_null(value)) {
+      php5to7_zval v;
+
+      if (php_driver_decode(value, &decoder->sub_decoders[index], &v TSRMLS_CC) == FAILURE) {
+        cass_iterator_free(iterator);
+        zval_ptr_dtor(out);
+        return FAILURE;
+      }
+
+      php_driver_tuple_set(tuple, index, PHP5TO7_ZVAL_MAYBE_P(v) TSRMLS_CC);
+      zval_ptr_dtor(&v);
+    }
+
+    index++;
+  }
+
+  cass_iterator_free(iterator);
+  return SUCCESS;
+}
+
+static int
+decode_udt(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
+{
   CassIterator *iterator;
-  php_driver_numeric *numeric = NULL;
-  php_driver_timestamp *timestamp = NULL;
-  php_driver_date *date = NULL;
-  php_driver_time *time = NULL;
-  php_driver_blob *blob = NULL;
-  php_driver_inet *inet = NULL;
-  php_driver_duration *duration = NULL;
-  php_driver_collection *collection = NULL;
-  php_driver_map *map = NULL;
-  php_driver_set *set = NULL;
-  php_driver_tuple *tuple = NULL;
-  php_driver_user_type_value *user_type_value = NULL;
+  php_driver_user_type_value *user_type_value;
   ulong index;
 
-  CassValueType type = cass_data_type_type(data_type);
-  const CassDataType* primary_type;
-  const CassDataType* secondary_type;
+  object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_user_type_value_ce);
+  user_type_value = PHP_DRIVER_GET_USER_TYPE_VALUE(PHP5TO7_ZVAL_MAYBE_DEREF(out));
+  PHP5TO7_ZVAL_COPY(PHP5TO7_ZVAL_MAYBE_P(user_type_value->type),
+                    PHP5TO7_ZVAL_MAYBE_P(decoder->type));
+
+  iterator = cass_iterator_fields_from_user_type(value);
+
+  index = 0;
+  while (cass_iterator_next(iterator) && index < decoder->sub_count) {
+    const CassValue* value = cass_iterator_get_user_type_field_value(iterator);
+
+    if (!cass_value_is_null(value)) {
+      const char *name;
+      size_t name_length;
+      php5to7_zval v;
+
+      if (php_driver_decode(value, &decoder->sub_decoders[index], &v TSRMLS_CC) == FAILURE) {
+        cass_iterator_free(iterator);
+        zval_ptr_dtor(out);
+        return FAILURE;
+      }
+
+      cass_iterator_get_user_type_field_name(iterator, &name, &name_length);
+      php_driver_user_type_value_set(user_type_value,
+                                     name, name_length,
+                                     PHP5TO7_ZVAL_MAYBE_P(v) TSRMLS_CC);
+      zval_ptr_dtor(&v);
+    }
+
+    index++;
+  }
+
+  cass_iterator_free(iterator);
+  return SUCCESS;
+}
+
+static php_driver_decode_function
+native_decode_function(CassValueType type)
+{
+  switch (type) {
+  case CASS_VALUE_TYPE_COUNTER:
+  case CASS_VALUE_TYPE_BIGINT:
+  case CASS_VALUE_TYPE_TIMESTAMP:
+  case CASS_VALUE_TYPE_TIME:
+    /* Only exact on platforms where a PHP integer holds 64 bits */
+    return sizeof(php5to7_long) >= sizeof(cass_int64_t) ? decode_native_bigint : NULL;
+  case CASS_VALUE_TYPE_SMALL_INT:
+    return decode_native_smallint;
+  case CASS_VALUE_TYPE_TINY_INT:
+    return decode_native_tinyint;
+  case CASS_VALUE_TYPE_FLOAT:
+    return decode_native_float;
+  case CASS_VALUE_TYPE_DATE:
+    return decode_native_date;
+  case CASS_VALUE_TYPE_UUID:
+  case CASS_VALUE_TYPE_TIMEUUID:
+    return decode_native_uuid;
+  case CASS_VALUE_TYPE_INET:
+    return decode_native_inet;
+  default:
+    return NULL;
+  }
+}
+
+void
+php_driver_decoder_init(php_driver_decoder *decoder, const CassDataType *data_type,
+                        int native TSRMLS_DC)
+{
+  size_t i;
+  CassValueType type = data_type ? cass_data_type_type(data_type)
+                                 : CASS_VALUE_TYPE_UNKNOWN;
+
+  decoder->data_type    = data_type;
+  decoder->sub_count    = 0;
+  decoder->sub_decoders = NULL;
+  PHP5TO7_ZVAL_UNDEF(decoder->type);
+
+  switch (type) {
+  case CASS_VALUE_TYPE_ASCII:
+  case CASS_VALUE_TYPE_TEXT:
+  case CASS_VALUE_TYPE_VARCHAR:
+    decoder->decode = decode_text;
+    break;
+  case CASS_VALUE_TYPE_INT:
+    decoder->decode = decode_int;
+    break;
+  case CASS_VALUE_TYPE_COUNTER:
+  case CASS_VALUE_TYPE_BIGINT:
+    decoder->decode = decode_bigint;
+    break;
+  case CASS_VALUE_TYPE_SMALL_INT:
+    decoder->decode = decode_smallint;
+    break;
+  case CASS_VALUE_TYPE_TINY_INT:
+    decoder->decode = decode_tinyint;
+    break;
+  case CASS_VALUE_TYPE_TIMESTAMP:
+    decoder->decode = decode_timestamp;
+    break;
+  case CASS_VALUE_TYPE_DATE:
+    decoder->decode = decode_date;
+    break;
+  case CASS_VALUE_TYPE_TIME:
+    decoder->decode = decode_time;
+    break;
+  case CASS_VALUE_TYPE_BLOB:
+    decoder->decode = decode_blob;
+    break;
+  case CASS_VALUE_TYPE_VARINT:
+    decoder->decode = decode_varint;
+    break;
+  case CASS_VALUE_TYPE_UUID:
+    decoder->decode = decode_uuid;
+    break;
+  case CASS_VALUE_TYPE_TIMEUUID:
+    decoder->decode = decode_timeuuid;
+    break;
+  case CASS_VALUE_TYPE_BOOLEAN:
+    decoder->decode = decode_boolean;
+    break;
+  case CASS_VALUE_TYPE_INET:
+    decoder->decode = decode_inet;
+    break;
+  case CASS_VALUE_TYPE_DECIMAL:
+    decoder->decode = decode_decimal;
+    break;
+  case CASS_VALUE_TYPE_DURATION:
+    decoder->decode = decode_duration;
+    break;
+  case CASS_VALUE_TYPE_DOUBLE:
+    decoder->decode = decode_double;
+    break;
+  case CASS_VALUE_TYPE_FLOAT:
+    decoder->decode = decode_float;
+    break;
+  case CASS_VALUE_TYPE_LIST:
+    decoder->decode = decode_list;
+    decoder->sub_count = 1;
+    break;
+  case CASS_VALUE_TYPE_SET:
+    decoder->decode = decode_set;
+    decoder->sub_count = 1;
+    break;
+  case CASS_VALUE_TYPE_MAP:
+    decoder->decode = decode_map;
+    decoder->sub_count = 2;
+    break;
+  case CASS_VALUE_TYPE_TUPLE:
+    decoder->decode = decode_tuple;
+    decoder->sub_count = cass_data_sub_type_count(data_type);
+    break;
+  case CASS_VALUE_TYPE_UDT:
+    decoder->decode = decode_udt;
+    decoder->sub_count = cass_data_sub_type_count(data_type);
+    break;
+  default:
+    decoder->decode = decode_null;
+    break;
+  }
+
+  if (native && native_decode_function(type)) {
+    decoder->decode = native_decode_function(type);
+  }
+
+  /* Every collection, tuple and UDT value decoded with this decoder shares
+   * the same type object. */
+  if (decoder->decode == decode_list || decoder->decode == decode_set ||
+      decoder->decode == decode_map || decoder->decode == decode_tuple ||
+      decoder->decode == decode_udt) {
+    decoder->type = php_driver_type_from_data_type(data_type TSRMLS_CC);
+  }
+
+  if (decoder->sub_count > 0) {
+    decoder->sub_decoders = (php_driver_decoder *) ecalloc(decoder->sub_count,
+                                                           sizeof(php_driver_decoder));
+    for (i = 0; i < decoder->sub_count; i++) {
+      /* Collection, tuple and UDT values are type checked against their
+       * element types, so their elements keep the wrapper objects */
+      php_driver_decoder_init(&decoder->sub_decoders[i],
+                              cass_data_type_sub_data_type(data_type, i), 0 TSRMLS_CC);
+    }
+  }
+}
+
+void
+php_driver_decoder_destroy(php_driver_decoder *decoder TSRMLS_DC)
+{
+  size_t i;
+
+  PHP5TO7_ZVAL_MAYBE_DESTROY(decoder->type);
+
+  if (decoder->sub_decoders) {
+    for (i = 0; i < decoder->sub_count; i++) {
+      php_driver_decoder_destroy(&decoder->sub_decoders[i] TSRMLS_CC);
+    }
+    efree(decoder->sub_decoders);
+    decoder->sub_decoders = NULL;
+  }
+}
+
+int
+php_driver_value(const CassValue* value, const CassDataType* data_type, php5to7_zval *out TSRMLS_DC)
+{
+  php_driver_decoder decoder;
+  int result;
+
+  php_driver_decoder_init(&decoder, data_type, 0 TSRMLS_CC);
+  result = php_driver_decode(value, &decoder, out TSRMLS_CC);
+  php_driver_decoder_destroy(&decoder TSRMLS_CC);
+
+  return result;
+}
+
+int
+php_driver_get_keyspace_field(const CassKeyspaceMeta *metadata, const char *field_name, php5to7_zval *out TSRMLS_DC)
+{
+  const CassValue *value;
+
+  value = cass_keyspace_meta_field_by_name(metadata, field_name);
+
+  if (value == NULL || cass_value_is_null(value)) {
+    PHP5TO7_ZVAL_MAYBE_MAKE(*out);
+    ZVAL_NULL(PHP5TO7_ZVAL_MAYBE_DEREF(out));
+    return SUCCESS;
+  }
+
+  return php_driver_value(value, cass_value_data_type(value), out TSRMLS_CC);
+}
+
+int
+php_driver_get_table_field(const CassTableMeta *metadata, const char *field_name, php5to7_zval *out TSRMLS_DC)
+{
+  const CassValue *value;
+
+  value = cass_table_meta_field_by_name(metadata, field_name);
+
+  if (value == NULL || cass_value_is_null(value)) {
+    PHP5TO7_ZVAL_MAYBE_MAKE(*out);
+    ZVAL_NULL(PHP5TO7_ZVAL_MAYBE_DEREF(out));
+    return SUCCESS;
+  }
+
+  return php_driver_value(value, cass_value_data_type(value), out TSRMLS_CC);
+}
+
+int
+php_driver_get_column_field(const CassColumnMeta *metadata, const char *field_name, php5to7_zval *out TSRMLS_DC)
+{
+  const CassValue *value;
+
+  value = cass_column_meta_field_by_name(metadata, field_name);
+
+  if (value == NULL || cass_value_is_null(value)) {
+    PHP5TO7_ZVAL_MAYBE_MAKE(*out);
+    ZVAL_NULL(PHP5TO7_ZVAL_MAYBE_DEREF(out));
+    return SUCCESS;
+  }
+
+  return php_driver_value(value, cass_value_data_type(value), out TSRMLS_CC);
+}
+
+
+void
+php_driver_result_options_init(php_driver_result_options *options)
+{
+  options->lazy         = -1;
+  options->row_objects  = -1;
+  options->native_types = -1;
+  options->fetch_style  = -1;
+  options->fetch_column = 0;
+  options->columnar     = -1;
+  PHP5TO7_ZVAL_UNDEF(options->columns);
+}
+
+void
+php_driver_result_options_merge(php_driver_result_options *options,
+                                const php_driver_result_options *other)
+{
+  if (other->lazy >= 0)
+    options->lazy = other->lazy;
+
+  if (other->row_objects >= 0)
+    options->row_objects = other->row_objects;
+
+  if (other->native_types >= 0)
+    options->native_types = other->native_types;
+
+  if (other->columnar >= 0)
+    options->columnar = other->columnar;
+
+  if (other->fetch_style >= 0) {
+    options->fetch_style  = other->fetch_style;
+    options->fetch_column = other->fetch_column;
+  }
+
+  if (!PHP5TO7_ZVAL_IS_UNDEF(other->columns)) {
+    PHP5TO7_ZVAL_MAYBE_DESTROY(options->columns);
+    PHP5TO7_ZVAL_COPY(PHP5TO7_ZVAL_MAYBE_P(options->columns),
+                      PHP5TO7_ZVAL_MAYBE_P(other->columns));
+  }
+}
 
-  PHP5TO7_ZVAL_MAYBE_MAKE(*out);
+void
+php_driver_result_options_destroy(php_driver_result_options *options)
+{
+  PHP5TO7_ZVAL_MAYBE_DESTROY(options->columns);
+}
 
-  if (cass_value_is_null(value)) {
-    ZVAL_NULL(PHP5TO7_ZVAL_MAYBE_DEREF(out));
-    return SUCCESS;
+static void
+result_plan_init_column(php_driver_result_plan *plan, size_t i,
+                        const CassResult *result, size_t column, int native TSRMLS_DC)
+{
+  const char *column_name;
+  size_t column_name_len;
+
+  cass_result_column_name(result, column, &column_name, &column_name_len);
+
+  plan->columns[i] = column;
+#if PHP_MAJOR_VERSION >= 7
+  plan->column_names[i] =
+    zend_new_interned_string(zend_string_init(column_name, column_name_len, 0));
+  zend_string_hash_val(plan->column_names[i]);
+#else
+  plan->column_names[i] = estrndup(column_name, column_name_len);
+#endif
+  php_driver_decoder_init(&plan->decoders[i],
+                          cass_result_column_data_type(result, column), native TSRMLS_CC);
+}
+
+static int
+result_find_column(const CassResult *result, const char *name, size_t name_len, size_t *column)
+{
+  const char *column_name;
+  size_t column_name_len;
+  size_t i, count = cass_result_column_count(result);
+
+  for (i = 0; i < count; i++) {
+    cass_result_column_name(result, i, &column_name, &column_name_len);
+    if (column_name_len == name_len && memcmp(column_name, name, name_len) == 0) {
+      *column = i;
+      return SUCCESS;
+    }
   }
 
-  switch (type) {
+  return FAILURE;
+}
+
+/* Keys of FETCH_KEY_PAIR and FETCH_GROUP pages are array offsets, only
+ * scalars and the value objects that convert to strings can be used */
+static int
+result_plan_key_supported(const CassDataType *data_type)
+{
+  switch (cass_data_type_type(data_type)) {
   case CASS_VALUE_TYPE_ASCII:
   case CASS_VALUE_TYPE_TEXT:
   case CASS_VALUE_TYPE_VARCHAR:
-    ASSERT_SUCCESS_BLOCK(cass_value_get_string(value, &v_string, &v_string_len),
-      zval_ptr_dtor(out);
-      return FAILURE;
-    );
-    PHP5TO7_ZVAL_STRINGL(PHP5TO7_ZVAL_MAYBE_DEREF(out), v_string, v_string_len);
-    break;
   case CASS_VALUE_TYPE_INT:
-    ASSERT_SUCCESS_BLOCK(cass_value_get_int32(value, &v_int_32),
-      zval_ptr_dtor(out);
-      return FAILURE;
-    );
-    ZVAL_LONG(PHP5TO7_ZVAL_MAYBE_DEREF(out), v_int_32);
-    break;
   case CASS_VALUE_TYPE_COUNTER:
   case CASS_VALUE_TYPE_BIGINT:
-    object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_bigint_ce);
-    numeric = PHP_DRIVER_GET_NUMERIC(PHP5TO7_ZVAL_MAYBE_DEREF(out));
-    ASSERT_SUCCESS_BLOCK(cass_value_get_int64(value, &numeric->data.bigint.value),
-      zval_ptr_dtor(out);
-      return FAILURE;
-    )
-    break;
   case CASS_VALUE_TYPE_SMALL_INT:
-    object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_smallint_ce);
-    numeric = PHP_DRIVER_GET_NUMERIC(PHP5TO7_ZVAL_MAYBE_DEREF(out));
-    ASSERT_SUCCESS_BLOCK(cass_value_get_int16(value, &numeric->data.smallint.value),
-      zval_ptr_dtor(out);
-      return FAILURE;
-    )
-    break;
   case CASS_VALUE_TYPE_TINY_INT:
-    object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_tinyint_ce);
-    numeric = PHP_DRIVER_GET_NUMERIC(PHP5TO7_ZVAL_MAYBE_DEREF(out));
-    ASSERT_SUCCESS_BLOCK(cass_value_get_int8(value, &numeric->data.tinyint.value),
-      zval_ptr_dtor(out);
-      return FAILURE;
-    )
-    break;
   case CASS_VALUE_TYPE_TIMESTAMP:
-    object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_timestamp_ce);
-    timestamp = PHP_DRIVER_GET_TIMESTAMP(PHP5TO7_ZVAL_MAYBE_DEREF(out));
-    ASSERT_SUCCESS_BLOCK(cass_value_get_int64(value, &timestamp->timestamp),
-      zval_ptr_dtor(out);
-      return FAILURE;
-    )
-    break;
   case CASS_VALUE_TYPE_DATE:
-    object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_date_ce);
-    date = PHP_DRIVER_GET_DATE(PHP5TO7_ZVAL_MAYBE_DEREF(out));
-    ASSERT_SUCCESS_BLOCK(cass_value_get_uint32(value, &date->date),
-      zval_ptr_dtor(out);
-      return FAILURE;
-    )
-    break;
   case CASS_VALUE_TYPE_TIME:
-    object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_time_ce);
-    time = PHP_DRIVER_GET_TIME(PHP5TO7_ZVAL_MAYBE_DEREF(out));
-    ASSERT_SUCCESS_BLOCK(cass_value_get_int64(value, &time->time),
-      zval_ptr_dtor(out);
-      return FAILURE;
-    )
-    break;
   case CASS_VALUE_TYPE_BLOB:
-    object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_blob_ce);
-    blob = PHP_DRIVER_GET_BLOB(PHP5TO7_ZVAL_MAYBE_DEREF(out));
-    ASSERT_SUCCESS_BLOCK(cass_value_get_bytes(value, &v_bytes, &v_bytes_len),
-      zval_ptr_dtor(out);
-      return FAILURE;
-    )
-    blob->data = emalloc(v_bytes_len * sizeof(cass_byte_t));
-    blob->size = v_bytes_len;
-    memcpy(blob->data, v_bytes, v_bytes_len);
-    break;
   case CASS_VALUE_TYPE_VARINT:
-    object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_varint_ce);
-    numeric = PHP_DRIVER_GET_NUMERIC(PHP5TO7_ZVAL_MAYBE_DEREF(out));
-    ASSERT_SUCCESS_BLOCK(cass_value_get_bytes(value, &v_bytes, &v_bytes_len),
-      zval_ptr_dtor(out);
-      return FAILURE;
-    );
-    import_twos_complement((cass_byte_t*) v_bytes, v_bytes_len, &numeric->data.varint.value);
-    break;
   case CASS_VALUE_TYPE_UUID:
-    object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_uuid_ce);
-    uuid = PHP_DRIVER_GET_UUID(PHP5TO7_ZVAL_MAYBE_DEREF(out));
-    ASSERT_SUCCESS_BLOCK(cass_value_get_uuid(value, &uuid->uuid),
-      zval_ptr_dtor(out);
-      return FAILURE;
-    )
-    break;
   case CASS_VALUE_TYPE_TIMEUUID:
-    object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_timeuuid_ce);
-    uuid = PHP_DRIVER_GET_UUID(PHP5TO7_ZVAL_MAYBE_DEREF(out));
-    ASSERT_SUCCESS_BLOCK(cass_value_get_uuid(value, &uuid->uuid),
-      zval_ptr_dtor(out);
-      return FAILURE;
-    )
-    break;
   case CASS_VALUE_TYPE_BOOLEAN:
-    ASSERT_SUCCESS_BLOCK(cass_value_get_bool(value, &v_boolean),
-      zval_ptr_dtor(out);
-      return FAILURE;
-    );
-    if (v_boolean) {
-      ZVAL_TRUE(PHP5TO7_ZVAL_MAYBE_DEREF(out));
-    } else {
-      ZVAL_FALSE(PHP5TO7_ZVAL_MAYBE_DEREF(out));
-    }
-    break;
   case CASS_VALUE_TYPE_INET:
-    object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_inet_ce);
-    inet = PHP_DRIVER_GET_INET(PHP5TO7_ZVAL_MAYBE_DEREF(out));
-    ASSERT_SUCCESS_BLOCK(cass_value_get_inet(value, &inet->inet),
-      zval_ptr_dtor(out);
-      return FAILURE;
-    )
-    break;
   case CASS_VALUE_TYPE_DECIMAL:
-    object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_decimal_ce);
-    numeric = PHP_DRIVER_GET_NUMERIC(PHP5TO7_ZVAL_MAYBE_DEREF(out));
-    ASSERT_SUCCESS_BLOCK(cass_value_get_decimal(value, &v_decimal, &v_decimal_len, &v_decimal_scale),
-      zval_ptr_dtor(out);
-      return FAILURE;
-    );
-    import_twos_complement((cass_byte_t*) v_decimal, v_decimal_len, &numeric->data.decimal.value);
-    numeric->data.decimal.scale = v_decimal_scale;
-    break;
   case CASS_VALUE_TYPE_DURATION:
-    object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_duration_ce);
-    duration = PHP_DRIVER_GET_DURATION(PHP5TO7_ZVAL_MAYBE_DEREF(out));
-    ASSERT_SUCCESS_BLOCK(cass_value_get_duration(value, &duration->months, &duration->days, &duration->nanos),
-      zval_ptr_dtor(out);
-      return FAILURE;
-    );
-    break;
   case CASS_VALUE_TYPE_DOUBLE:
-    ASSERT_SUCCESS_BLOCK(cass_value_get_double(value, &v_double),
-      zval_ptr_dtor(out);
-      return FAILURE;
-    );
-    ZVAL_DOUBLE(PHP5TO7_ZVAL_MAYBE_DEREF(out), v_double);
-    break;
   case CASS_VALUE_TYPE_FLOAT:
-    object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_float_ce);
-    numeric = PHP_DRIVER_GET_NUMERIC(PHP5TO7_ZVAL_MAYBE_DEREF(out));
-    ASSERT_SUCCESS_BLOCK(cass_value_get_float(value, &numeric->data.floating.value),
-      zval_ptr_dtor(out);
-      return FAILURE;
-    )
-    break;
-  case CASS_VALUE_TYPE_LIST:
-    object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_collection_ce);
-    collection = PHP_DRIVER_GET_COLLECTION(PHP5TO7_ZVAL_MAYBE_DEREF(out));
-
-    primary_type = cass_data_type_sub_data_type(data_type, 0);
-    collection->type = php_driver_type_from_data_type(data_type TSRMLS_CC);
-
-    iterator = cass_iterator_from_collection(value);
-
-    while (cass_iterator_next(iterator)) {
-      php5to7_zval v;
+    return 1;
+  default:
+    return 0;
+  }
+}
 
-      if (php_driver_value(cass_iterator_get_value(iterator), primary_type, &v TSRMLS_CC) == FAILURE) {
-        cass_iterator_free(iterator);
-        zval_ptr_dtor(out);
-        return FAILURE;
-      }
+static int
+result_plan_check_key(php_driver_result_plan *plan TSRMLS_DC)
+{
+  if (plan->fetch_style != PHP_DRIVER_FETCH_KEY_PAIR &&
+      plan->fetch_style != PHP_DRIVER_FETCH_GROUP)
+    return SUCCESS;
 
-      php_driver_collection_add(collection, PHP5TO7_ZVAL_MAYBE_P(v) TSRMLS_CC);
-      zval_ptr_dtor(&v);
-    }
+  if (!result_plan_key_supported(plan->decoders[0].data_type)) {
+    zend_throw_exception_ex(php_driver_invalid_argument_exception_ce, 0 TSRMLS_CC,
+                            "The values of the first column can't be used as keys of the fetch style");
+    php_driver_result_plan_free(plan TSRMLS_CC);
+    return FAILURE;
+  }
 
-    cass_iterator_free(iterator);
-    break;
-  case CASS_VALUE_TYPE_MAP:
-    object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_map_ce);
-    map = PHP_DRIVER_GET_MAP(PHP5TO7_ZVAL_MAYBE_DEREF(out));
+  return SUCCESS;
+}
 
-    primary_type = cass_data_type_sub_data_type(data_type, 0);
-    secondary_type = cass_data_type_sub_data_type(data_type, 1);
-    map->type = php_driver_type_from_data_type(data_type TSRMLS_CC);
+php_driver_result_plan *
+php_driver_result_plan_new(const CassResult *result,
+                           const php_driver_result_options *options TSRMLS_DC)
+{
+  php_driver_result_plan *plan;
+  HashTable *projection = NULL;
+  php5to7_zval *name;
+  size_t column;
+  size_t i;
+  int native = options && options->native_types > 0;
+
+  if (options && !PHP5TO7_ZVAL_IS_UNDEF(options->columns)) {
+    projection = PHP5TO7_Z_ARRVAL_MAYBE_P(options->columns);
+  }
 
-    iterator = cass_iterator_from_map(value);
+  plan = (php_driver_result_plan *) emalloc(sizeof(php_driver_result_plan));
+  plan->column_count = projection ? zend_hash_num_elements(projection)
+                                  : cass_result_column_count(result);
+  plan->columns      = (size_t *) ecalloc(plan->column_count, sizeof(size_t));
+  plan->column_names = ecalloc(plan->column_count, sizeof(*plan->column_names));
+  plan->decoders     = (php_driver_decoder *) ecalloc(plan->column_count,
+                                                      sizeof(php_driver_decoder));
+  plan->positions    = NULL;
+  plan->fetch_style  = PHP_DRIVER_FETCH_ASSOC;
+  plan->fetch_column = 0;
+
+  if (options && options->fetch_style >= 0) {
+    plan->fetch_style  = (php_driver_fetch_style) options->fetch_style;
+    plan->fetch_column = (size_t) options->fetch_column;
+  }
 
-    while (cass_iterator_next(iterator)) {
-      php5to7_zval k;
-      php5to7_zval v;
+  if ((plan->fetch_style == PHP_DRIVER_FETCH_COLUMN && plan->fetch_column >= plan->column_count) ||
+      ((plan->fetch_style == PHP_DRIVER_FETCH_KEY_PAIR ||
+        plan->fetch_style == PHP_DRIVER_FETCH_GROUP) && plan->column_count < 2)) {
+    zend_throw_exception_ex(php_driver_invalid_argument_exception_ce, 0 TSRMLS_CC,
+                            "The fetch style requires more columns than the result has");
+    plan->column_count = 0;
+    php_driver_result_plan_free(plan TSRMLS_CC);
+    return NULL;
+  }
 
-      if (php_driver_value(cass_iterator_get_map_key(iterator), primary_type, &k TSRMLS_CC) == FAILURE ||
-          php_driver_value(cass_iterator_get_map_value(iterator), secondary_type, &v TSRMLS_CC) == FAILURE) {
-        cass_iterator_free(iterator);
-        zval_ptr_dtor(out);
-        return FAILURE;
+  if (!projection) {
+    for (i = 0; i < plan->column_count; i++) {
+      result_plan_init_column(plan, i, result, i, native TSRMLS_CC);
+    }
+  } else {
+    i = 0;
+    PHP5TO7_ZEND_HASH_FOREACH_VAL(projection, name) {
+      if (result_find_column(result,
+                             Z_STRVAL_P(PHP5TO7_ZVAL_MAYBE_DEREF(name)),
+                             Z_STRLEN_P(PHP5TO7_ZVAL_MAYBE_DEREF(name)),
+                             &column) == FAILURE) {
+        zend_throw_exception_ex(php_driver_invalid_argument_exception_ce, 0 TSRMLS_CC,
+                                "Unknown column '%s' in the result's projection",
+                                Z_STRVAL_P(PHP5TO7_ZVAL_MAYBE_DEREF(name)));
+        plan->column_count = i;
+        php_driver_result_plan_free(plan TSRMLS_CC);
+        return NULL;
       }
+      result_plan_init_column(plan, i++, result, column, native TSRMLS_CC);
+    } PHP5TO7_ZEND_HASH_FOREACH_END(projection);
+  }
 
-      php_driver_map_set(map, PHP5TO7_ZVAL_MAYBE_P(k), PHP5TO7_ZVAL_MAYBE_P(v) TSRMLS_CC);
-      zval_ptr_dtor(&k);
-      zval_ptr_dtor(&v);
-    }
+  if (result_plan_check_key(plan TSRMLS_CC) == FAILURE)
+    return NULL;
 
-    cass_iterator_free(iterator);
-    break;
-  case CASS_VALUE_TYPE_SET:
-    object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_set_ce);
-    set = PHP_DRIVER_GET_SET(PHP5TO7_ZVAL_MAYBE_DEREF(out));
+  return plan;
+}
 
-    primary_type = cass_data_type_sub_data_type(data_type, 0);
-    set->type = php_driver_type_from_data_type(data_type TSRMLS_CC);
+void
+php_driver_result_plan_free(php_driver_result_plan *plan TSRMLS_DC)
+{
+  size_t i;
+
+  for (i = 0; i < plan->column_count; i++) {
+#if PHP_MAJOR_VERSION >= 7
+    zend_string_release(plan->column_names[i]);
+#else
+    efree(plan->column_names[i]);
+#endif
+    php_driver_decoder_destroy(&plan->decoders[i] TSRMLS_CC);
+  }
 
-    iterator = cass_iterator_from_collection(value);
+#if PHP_MAJOR_VERSION >= 7
+  if (plan->positions) {
+    zend_hash_destroy(plan->positions);
+    FREE_HASHTABLE(plan->positions);
+  }
+#endif
 
-    while (cass_iterator_next(iterator)) {
-      php5to7_zval v;
+  efree(plan->columns);
+  efree(plan->column_names);
+  efree(plan->decoders);
+  efree(plan);
+}
 
-      if (php_driver_value(cass_iterator_get_value(iterator), primary_type, &v TSRMLS_CC) == FAILURE) {
-        cass_iterator_free(iterator);
-        zval_ptr_dtor(out);
-        return FAILURE;
-      }
+#if PHP_MAJOR_VERSION >= 7
+int
+php_driver_result_plan_position(php_driver_result_plan *plan, zend_string *name, size_t *position)
+{
+  zval *entry;
+  size_t i;
 
-      php_driver_set_add(set, PHP5TO7_ZVAL_MAYBE_P(v) TSRMLS_CC);
-      zval_ptr_dtor(&v);
-    }
+  if (plan->positions == NULL) {
+    ALLOC_HASHTABLE(plan->positions);
+    zend_hash_init(plan->positions, plan->column_count, NULL, NULL, 0);
 
-    cass_iterator_free(iterator);
-    break;
-  case CASS_VALUE_TYPE_TUPLE:
-    object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_tuple_ce);
-    tuple = PHP_DRIVER_GET_TUPLE(PHP5TO7_ZVAL_MAYBE_DEREF(out));
+    for (i = 0; i < plan->column_count; i++) {
+      zval zposition;
+      ZVAL_LONG(&zposition, (zend_long) i);
+      zend_hash_add(plan->positions, plan->column_names[i], &zposition);
+    }
+  }
 
-    tuple->type = php_driver_type_from_data_type(data_type TSRMLS_CC);
+  entry = zend_hash_find(plan->positions, name);
+  if (entry == NULL) {
+    return FAILURE;
+  }
 
-    iterator = cass_iterator_from_tuple(value);
+  *position = (size_t) Z_LVAL_P(entry);
+  return SUCCESS;
+}
+#endif
 
-    index = 0;
-    while (cass_iterator_next(iterator)) {
-      const CassValue* value = cass_iterator_get_value(iterator);
+static int
+result_plan_decode_cell(const php_driver_result_plan *plan,
+                        const CassRow *cass_row, size_t position,
+                        php5to7_zval *out TSRMLS_DC)
+{
+  return php_driver_decode(cass_row_get_column(cass_row, plan->columns[position]),
+                           &plan->decoders[position], out TSRMLS_CC);
+}
 
-      if (!cass_value_is_null(value)) {
-        php5to7_zval v;
+static int
+result_plan_decode_assoc(const php_driver_result_plan *plan,
+                         const CassRow *cass_row, size_t first,
+                         php5to7_zval *out TSRMLS_DC)
+{
+  php5to7_zval row;
+  size_t i;
 
-        primary_type = cass_data_type_sub_data_type(data_type, index);
-        if (php_driver_value(value, primary_type, &v TSRMLS_CC) == FAILURE) {
-          cass_iterator_free(iterator);
-          zval_ptr_dtor(out);
-          return FAILURE;
-        }
+  PHP5TO7_ZVAL_MAYBE_MAKE(row);
+  array_init_size(PHP5TO7_ZVAL_MAYBE_P(row), plan->column_count - first);
 
-        php_driver_tuple_set(tuple, index, PHP5TO7_ZVAL_MAYBE_P(v) TSRMLS_CC);
-        zval_ptr_dtor(&v);
-      }
+  for (i = first; i < plan->column_count; i++) {
+    php5to7_zval value;
 
-      index++;
+    if (result_plan_decode_cell(plan, cass_row, i, &value TSRMLS_CC) == FAILURE) {
+      zval_ptr_dtor(&row);
+      return FAILURE;
     }
 
-    cass_iterator_free(iterator);
-    break;
-  case CASS_VALUE_TYPE_UDT:
-    object_init_ex(PHP5TO7_ZVAL_MAYBE_DEREF(out), php_driver_user_type_value_ce);
-    user_type_value = PHP_DRIVER_GET_USER_TYPE_VALUE(PHP5TO7_ZVAL_MAYBE_DEREF(out));
-
-    user_type_value->type = php_driver_type_from_data_type(data_type TSRMLS_CC);
+#if PHP_MAJOR_VERSION >= 7
+    zend_symtable_update(Z_ARRVAL(row), plan->column_names[i], &value);
+#else
+    PHP5TO7_ADD_ASSOC_ZVAL_EX(PHP5TO7_ZVAL_MAYBE_P(row),
+                              plan->column_names[i], strlen(plan->column_names[i]) + 1,
+                              PHP5TO7_ZVAL_MAYBE_P(value));
+#endif
+  }
 
-    iterator = cass_iterator_fields_from_user_type(value);
+  *out = row;
 
-    index = 0;
-    while (cass_iterator_next(iterator)) {
-      const CassValue* value = cass_iterator_get_user_type_field_value(iterator);
+  return SUCCESS;
+}
 
-      if (!cass_value_is_null(value)) {
-        const char *name;
-        size_t name_length;
-        php5to7_zval v;
+static int
+result_plan_decode_num(const php_driver_result_plan *plan,
+                       const CassRow *cass_row,
+                       php5to7_zval *out TSRMLS_DC)
+{
+  php5to7_zval row;
+  size_t i;
 
-        primary_type = cass_data_type_sub_data_type(data_type, index);
-        if (php_driver_value(value, primary_type, &v TSRMLS_CC) == FAILURE) {
-          cass_iterator_free(iterator);
-          zval_ptr_dtor(out);
-          return FAILURE;
-        }
+  PHP5TO7_ZVAL_MAYBE_MAKE(row);
+  array_init_size(PHP5TO7_ZVAL_MAYBE_P(row), plan->column_count);
 
-        cass_iterator_get_user_type_field_name(iterator, &name, &name_length);
-        php_driver_user_type_value_set(user_type_value,
-                                          name, name_length,
-                                          PHP5TO7_ZVAL_MAYBE_P(v) TSRMLS_CC);
-        zval_ptr_dtor(&v);
-      }
+  for (i = 0; i < plan->column_count; i++) {
+    php5to7_zval value;
 
-      index++;
+    if (result_plan_decode_cell(plan, cass_row, i, &value TSRMLS_CC) == FAILURE) {
+      zval_ptr_dtor(&row);
+      return FAILURE;
     }
 
-    cass_iterator_free(iterator);
-    break;
-  default:
-    ZVAL_NULL(PHP5TO7_ZVAL_MAYBE_DEREF(out));
-    break;
+    add_next_index_zval(PHP5TO7_ZVAL_MAYBE_P(row), PHP5TO7_ZVAL_MAYBE_P(value));
   }
 
+  *out = row;
+
   return SUCCESS;
 }
 
 int
-php_driver_get_keyspace_field(const CassKeyspaceMeta *metadata, const char *field_name, php5to7_zval *out TSRMLS_DC)
+php_driver_result_plan_decode_row(const php_driver_result_plan *plan,
+                                  const CassRow *cass_row,
+                                  php5to7_zval *out TSRMLS_DC)
 {
-  const CassValue *value;
-
-  value = cass_keyspace_meta_field_by_name(metadata, field_name);
-
-  if (value == NULL || cass_value_is_null(value)) {
-    PHP5TO7_ZVAL_MAYBE_MAKE(*out);
-    ZVAL_NULL(PHP5TO7_ZVAL_MAYBE_DEREF(out));
-    return SUCCESS;
+  switch (plan->fetch_style) {
+  case PHP_DRIVER_FETCH_NUM:
+    return result_plan_decode_num(plan, cass_row, out TSRMLS_CC);
+  case PHP_DRIVER_FETCH_COLUMN:
+    return result_plan_decode_cell(plan, cass_row, plan->fetch_column, out TSRMLS_CC);
+  default:
+    return result_plan_decode_assoc(plan, cass_row, 0, out TSRMLS_CC);
   }
-
-  return php_driver_value(value, cass_value_data_type(value), out TSRMLS_CC);
 }
 
-int
-php_driver_get_table_field(const CassTableMeta *metadata, const char *field_name, php5to7_zval *out TSRMLS_DC)
+/* Finds the entry of a keyed page (FETCH_KEY_PAIR, FETCH_GROUP) for the given
+ * column value, following PHP's rules for array offsets. Values that can't be
+ * used as offsets directly, such as uuids or bigints, use their string
+ * representation, the plan only allows key columns that have one. */
+static php5to7_zval *
+result_page_find(zval *page, zval *key TSRMLS_DC)
 {
-  const CassValue *value;
+  php5to7_zval *entry;
 
-  value = cass_table_meta_field_by_name(metadata, field_name);
+  if (Z_TYPE_P(key) != IS_LONG && Z_TYPE_P(key) != IS_STRING) {
+    convert_to_string(key);
+  }
 
-  if (value == NULL || cass_value_is_null(value)) {
-    PHP5TO7_ZVAL_MAYBE_MAKE(*out);
-    ZVAL_NULL(PHP5TO7_ZVAL_MAYBE_DEREF(out));
-    return SUCCESS;
+  if (Z_TYPE_P(key) == IS_LONG) {
+    if (PHP5TO7_ZEND_HASH_INDEX_FIND(Z_ARRVAL_P(page), Z_LVAL_P(key), entry)) {
+      return entry;
+    }
+    return NULL;
   }
 
-  return php_driver_value(value, cass_value_data_type(value), out TSRMLS_CC);
+#if PHP_MAJOR_VERSION >= 7
+  entry = zend_symtable_str_find(Z_ARRVAL_P(page), Z_STRVAL_P(key), Z_STRLEN_P(key));
+#else
+  if (zend_symtable_find(Z_ARRVAL_P(page), Z_STRVAL_P(key), Z_STRLEN_P(key) + 1,
+                         (void **) &entry) == FAILURE) {
+    entry = NULL;
+  }
+#endif
+
+  return entry;
 }
 
-int
-php_driver_get_column_field(const CassColumnMeta *metadata, const char *field_name, php5to7_zval *out TSRMLS_DC)
+static void
+result_page_update(zval *page, zval *key, zval *value TSRMLS_DC)
 {
-  const CassValue *value;
+  if (Z_TYPE_P(key) != IS_LONG && Z_TYPE_P(key) != IS_STRING) {
+    convert_to_string(key);
+  }
 
-  value = cass_column_meta_field_by_name(metadata, field_name);
+  if (Z_TYPE_P(key) == IS_LONG) {
+    add_index_zval(page, Z_LVAL_P(key), value);
+  } else {
+    PHP5TO7_ADD_ASSOC_ZVAL_EX(page, Z_STRVAL_P(key), Z_STRLEN_P(key) + 1, value);
+  }
+}
 
-  if (value == NULL || cass_value_is_null(value)) {
-    PHP5TO7_ZVAL_MAYBE_MAKE(*out);
-    ZVAL_NULL(PHP5TO7_ZVAL_MAYBE_DEREF(out));
+static int
+result_page_add_row(zval *page, const php_driver_result_plan *plan,
+                    const CassRow *cass_row TSRMLS_DC)
+{
+  php5to7_zval key;
+  php5to7_zval value;
+  php5to7_zval *group;
+
+  switch (plan->fetch_style) {
+  case PHP_DRIVER_FETCH_KEY_PAIR:
+    if (result_plan_decode_cell(plan, cass_row, 0, &key TSRMLS_CC) == FAILURE) {
+      return FAILURE;
+    }
+    if (result_plan_decode_cell(plan, cass_row, 1, &value TSRMLS_CC) == FAILURE) {
+      zval_ptr_dtor(&key);
+      return FAILURE;
+    }
+    result_page_update(page, PHP5TO7_ZVAL_MAYBE_P(key), PHP5TO7_ZVAL_MAYBE_P(value) TSRMLS_CC);
+    zval_ptr_dtor(&key);
+    return SUCCESS;
+  case PHP_DRIVER_FETCH_GROUP:
+    if (result_plan_decode_cell(plan, cass_row, 0, &key TSRMLS_CC) == FAILURE) {
+      return FAILURE;
+    }
+    if (result_plan_decode_assoc(plan, cass_row, 1, &value TSRMLS_CC) == FAILURE) {
+      zval_ptr_dtor(&key);
+      return FAILURE;
+    }
+    group = result_page_find(page, PHP5TO7_ZVAL_MAYBE_P(key) TSRMLS_CC);
+    if (group) {
+      add_next_index_zval(PHP5TO7_ZVAL_MAYBE_DEREF(group), PHP5TO7_ZVAL_MAYBE_P(value));
+    } else {
+      php5to7_zval rows;
+      PHP5TO7_ZVAL_MAYBE_MAKE(rows);
+      array_init(PHP5TO7_ZVAL_MAYBE_P(rows));
+      add_next_index_zval(PHP5TO7_ZVAL_MAYBE_P(rows), PHP5TO7_ZVAL_MAYBE_P(value));
+      result_page_update(page, PHP5TO7_ZVAL_MAYBE_P(key), PHP5TO7_ZVAL_MAYBE_P(rows) TSRMLS_CC);
+    }
+    zval_ptr_dtor(&key);
+    return SUCCESS;
+  default:
+    if (php_driver_result_plan_decode_row(plan, cass_row, &value TSRMLS_CC) == FAILURE) {
+      return FAILURE;
+    }
+    add_next_index_zval(page, PHP5TO7_ZVAL_MAYBE_P(value));
     return SUCCESS;
   }
-
-  return php_driver_value(value, cass_value_data_type(value), out TSRMLS_CC);
 }
 
 int
-php_driver_get_result(const CassResult *result, php5to7_zval *out TSRMLS_DC)
-{
-  php5to7_zval     rows;
-  php5to7_zval     row;
-  const CassRow   *cass_row;
-  const char      *column_name;
-  size_t           column_name_len;
-  const CassDataType* column_type;
-  const CassValue *column_value;
-  CassIterator    *iterator = NULL;
-  size_t           columns = -1;
-  char           **column_names;
-  unsigned         i;
+php_driver_result_plan_decode_columns(const php_driver_result_plan *plan,
+                                      const CassResult *result,
+                                      php5to7_zval *out TSRMLS_DC)
+{
+  php5to7_zval columns;
+  php5to7_zval *values;
+  CassIterator *iterator;
+  size_t row_count = cass_result_row_count(result);
+  size_t i;
 
-  PHP5TO7_ZVAL_MAYBE_MAKE(rows);
-  array_init(PHP5TO7_ZVAL_MAYBE_P(rows));
+  values = (php5to7_zval *) ecalloc(plan->column_count, sizeof(php5to7_zval));
+  for (i = 0; i < plan->column_count; i++) {
+    PHP5TO7_ZVAL_MAYBE_MAKE(values[i]);
+    array_init_size(PHP5TO7_ZVAL_MAYBE_P(values[i]), row_count);
+  }
 
   iterator = cass_iterator_from_result(result);
-  columns  = cass_result_column_count(result);
-
-  column_names = (char**) ecalloc(columns, sizeof(char*));
 
   while (cass_iterator_next(iterator)) {
-    PHP5TO7_ZVAL_MAYBE_MAKE(row);
-    array_init(PHP5TO7_ZVAL_MAYBE_P(row));
-    cass_row = cass_iterator_get_row(iterator);
+    const CassRow *cass_row = cass_iterator_get_row(iterator);
 
-    for (i = 0; i < columns; i++) {
+    for (i = 0; i < plan->column_count; i++) {
       php5to7_zval value;
 
-      if (column_names[i] == NULL) {
-        cass_result_column_name(result, i, &column_name, &column_name_len);
-        column_names[i] = estrndup(column_name, column_name_len);
+      if (result_plan_decode_cell(plan, cass_row, i, &value TSRMLS_CC) == FAILURE) {
+        cass_iterator_free(iterator);
+        for (i = 0; i < plan->column_count; i++) {
+          zval_ptr_dtor(&values[i]);
+        }
+        efree(values);
+        return FAILURE;
       }
 
-      column_type  = cass_result_column_data_type(result, i);
-      column_value = cass_row_get_column(cass_row, i);
+      add_next_index_zval(PHP5TO7_ZVAL_MAYBE_P(values[i]), PHP5TO7_ZVAL_MAYBE_P(value));
+    }
+  }
 
-      if (php_driver_value(column_value, column_type, &value TSRMLS_CC) == FAILURE) {
-        zval_ptr_dtor(&row);
-        zval_ptr_dtor(&rows);
+  cass_iterator_free(iterator);
 
-        for (i = 0; i < columns; i++) {
-          if (column_names[i]) {
-            efree(column_names[i]);
-          }
-        }
+  PHP5TO7_ZVAL_MAYBE_MAKE(columns);
+  array_init_size(PHP5TO7_ZVAL_MAYBE_P(columns), plan->column_count);
 
-        efree(column_names);
-        cass_iterator_free(iterator);
+  for (i = 0; i < plan->column_count; i++) {
+    if (plan->fetch_style == PHP_DRIVER_FETCH_NUM) {
+      add_next_index_zval(PHP5TO7_ZVAL_MAYBE_P(columns), PHP5TO7_ZVAL_MAYBE_P(values[i]));
+      continue;
+    }
+#if PHP_MAJOR_VERSION >= 7
+    zend_symtable_update(Z_ARRVAL(columns), plan->column_names[i], &values[i]);
+#else
+    PHP5TO7_ADD_ASSOC_ZVAL_EX(PHP5TO7_ZVAL_MAYBE_P(columns),
+                              plan->column_names[i], strlen(plan->column_names[i]) + 1,
+                              PHP5TO7_ZVAL_MAYBE_P(values[i]));
+#endif
+  }
 
-        return FAILURE;
-      }
+  efree(values);
+  *out = columns;
 
-      PHP5TO7_ADD_ASSOC_ZVAL_EX(PHP5TO7_ZVAL_MAYBE_P(row),
-                                column_names[i], strlen(column_names[i]) + 1,
-                                PHP5TO7_ZVAL_MAYBE_P(value));
-    }
+  return SUCCESS;
+}
+
+int
+php_driver_get_result(const CassResult *result,
+                      const php_driver_result_options *options,
+                      php5to7_zval *out TSRMLS_DC)
+{
+  php5to7_zval            rows;
+  CassIterator           *iterator;
+  php_driver_result_plan *plan;
 
-    add_next_index_zval(PHP5TO7_ZVAL_MAYBE_P(rows),
-                        PHP5TO7_ZVAL_MAYBE_P(row));
+  plan = php_driver_result_plan_new(result, options TSRMLS_CC);
+  if (!plan) {
+    return FAILURE;
   }
 
-  for (i = 0; i < columns; i++) {
-    if (column_names[i] != NULL) {
-      efree(column_names[i]);
+  PHP5TO7_ZVAL_MAYBE_MAKE(rows);
+  array_init_size(PHP5TO7_ZVAL_MAYBE_P(rows), cass_result_row_count(result));
+
+  iterator = cass_iterator_from_result(result);
+
+  while (cass_iterator_next(iterator)) {
+    if (result_page_add_row(PHP5TO7_ZVAL_MAYBE_P(rows), plan,
+                            cass_iterator_get_row(iterator) TSRMLS_CC) == FAILURE) {
+      zval_ptr_dtor(&rows);
+      cass_iterator_free(iterator);
+      php_driver_result_plan_free(plan TSRMLS_CC);
+
+      return FAILURE;
     }
   }
 
-  efree(column_names);
   cass_iterator_free(iterator);
+  php_driver_result_plan_free(plan TSRMLS_CC);
 
   *out = rows;
 
   return SUCCESS;
 }
+
+php_driver_result_cursor *
+php_driver_result_cursor_new(php_driver_ref *result,
+                             const php_driver_result_options *options TSRMLS_DC)
+{
+  php_driver_result_cursor *cursor;
+  php_driver_result_plan *plan;
+
+  plan = php_driver_result_plan_new((const CassResult *) result->data, options TSRMLS_CC);
+  if (!plan) {
+    return NULL;
+  }
+
+  cursor = (php_driver_result_cursor *) emalloc(sizeof(php_driver_result_cursor));
+  cursor->result   = php_driver_add_ref(result);
+  cursor->plan     = plan;
+  cursor->iterator = NULL;
+  cursor->position = 0;
+  cursor->count    = cass_result_row_count((const CassResult *) result->data);
+
+  return cursor;
+}
+
+void
+php_driver_result_cursor_free(php_driver_result_cursor *cursor TSRMLS_DC)
+{
+  if (cursor->iterator) {
+    cass_iterator_free(cursor->iterator);
+  }
+
+  php_driver_result_plan_free(cursor->plan TSRMLS_CC);
+  php_driver_del_ref(&cursor->result);
+  efree(cursor);
+}
+
+const CassRow *
+php_driver_result_cursor_seek(php_driver_result_cursor *cursor, size_t index)
+{
+  if (index >= cursor->count) {
+    return NULL;
+  }
+
+  /* The iterator only moves forward, start over when going back. */
+  if (cursor->iterator == NULL || cursor->position > index + 1) {
+    if (cursor->iterator) {
+      cass_iterator_free(cursor->iterator);
+    }
+    cursor->iterator = cass_iterator_from_result((const CassResult *) cursor->result->data);
+    cursor->position = 0;
+  }
+
+  while (cursor->position <= index) {
+    if (!cass_iterator_next(cursor->iterator)) {
+      return NULL;
+    }
+    cursor->position++;
+  }
+
+  return cass_iterator_get_row(cursor->iterator);
+}
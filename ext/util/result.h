@@ -17,13 +17,121 @@
 #ifndef PHP_DRIVER_RESULT_H
 #define PHP_DRIVER_RESULT_H
 
+typedef struct php_driver_decoder_ php_driver_decoder;
+
+typedef int (*php_driver_decode_function)(const CassValue *value,
+                                          const php_driver_decoder *decoder,
+                                          php5to7_zval *out TSRMLS_DC);
+
+/* A decoder resolves the decode function for a data type, and for all of its
+ * sub-types, ahead of time so that decoding a value never has to switch on its
+ * type. Data type pointers are borrowed from the owning result or metadata.
+ * Collection, tuple and UDT decoders also hold the Type object shared by all
+ * of the values they produce. */
+struct php_driver_decoder_ {
+  php_driver_decode_function decode;
+  const CassDataType *data_type;
+  php5to7_zval type;
+  size_t sub_count;
+  php_driver_decoder *sub_decoders;
+};
+
+/* The decoding plan of a result: one decoder per column, built once and then
+ * reused for every row of the result. Only the projected columns are planned;
+ * columns maps each of them back to its index in the result. Column names are
+ * (interned when possible) zend_strings with their hash precomputed, so they
+ * can be used as row keys directly. */
+typedef struct {
+  size_t column_count;
+  size_t *columns;
+  HashTable *positions;
+  php_driver_fetch_style fetch_style;
+  size_t fetch_column;
+#if PHP_MAJOR_VERSION >= 7
+  zend_string **column_names;
+#else
+  char **column_names;
+#endif
+  php_driver_decoder *decoders;
+} php_driver_result_plan;
+
+void php_driver_decoder_init(php_driver_decoder *decoder, const CassDataType *data_type,
+                             int native TSRMLS_DC);
+void php_driver_decoder_destroy(php_driver_decoder *decoder TSRMLS_DC);
+
+static inline int
+php_driver_decode(const CassValue *value, const php_driver_decoder *decoder, php5to7_zval *out TSRMLS_DC)
+{
+  PHP5TO7_ZVAL_MAYBE_MAKE(*out);
+
+  if (cass_value_is_null(value)) {
+    ZVAL_NULL(PHP5TO7_ZVAL_MAYBE_DEREF(out));
+    return SUCCESS;
+  }
+
+  return decoder->decode(value, decoder, out TSRMLS_CC);
+}
+
 int php_driver_value(const CassValue* value, const CassDataType* data_type, php5to7_zval *out TSRMLS_DC);
 
 int php_driver_get_keyspace_field(const CassKeyspaceMeta *metadata, const char *field_name, php5to7_zval *out TSRMLS_DC);
 int php_driver_get_table_field(const CassTableMeta *metadata, const char *field_name, php5to7_zval *out TSRMLS_DC);
 int php_driver_get_column_field(const CassColumnMeta *metadata, const char *field_name, php5to7_zval *out TSRMLS_DC);
 
-int php_driver_get_result(const CassResult *result, php5to7_zval *out TSRMLS_DC);
+void php_driver_result_options_init(php_driver_result_options *options);
+void php_driver_result_options_merge(php_driver_result_options *options,
+                                     const php_driver_result_options *other);
+void php_driver_result_options_destroy(php_driver_result_options *options);
+
+static inline int
+php_driver_result_options_keyed(const php_driver_result_options *options)
+{
+  return options->fetch_style == PHP_DRIVER_FETCH_KEY_PAIR ||
+         options->fetch_style == PHP_DRIVER_FETCH_GROUP;
+}
+
+/* Keyed fetch styles shape the whole page, so they are always decoded eagerly */
+static inline int
+php_driver_result_options_lazy(const php_driver_result_options *options)
+{
+  return (options->lazy > 0 || options->row_objects > 0 || options->columnar > 0) &&
+         !php_driver_result_options_keyed(options);
+}
+
+php_driver_result_plan *php_driver_result_plan_new(const CassResult *result,
+                                                   const php_driver_result_options *options TSRMLS_DC);
+void php_driver_result_plan_free(php_driver_result_plan *plan TSRMLS_DC);
+#if PHP_MAJOR_VERSION >= 7
+int php_driver_result_plan_position(php_driver_result_plan *plan, zend_string *name, size_t *position);
+#endif
+int php_driver_result_plan_decode_row(const php_driver_result_plan *plan,
+                                      const CassRow *row,
+                                      php5to7_zval *out TSRMLS_DC);
+
+/* Decodes a whole page as one packed array of values per column, keyed by
+ * column name or, for FETCH_NUM, by column position */
+int php_driver_result_plan_decode_columns(const php_driver_result_plan *plan,
+                                          const CassResult *result,
+                                          php5to7_zval *out TSRMLS_DC);
+int php_driver_get_result(const CassResult *result,
+                          const php_driver_result_options *options,
+                          php5to7_zval *out TSRMLS_DC);
+
+/* A cursor decodes the rows of a result on demand. It keeps a reference to the
+ * result, the result's decoding plan and a row iterator that is only rewound
+ * when a row before the current one is requested. */
+typedef struct {
+  php_driver_ref *result;
+  php_driver_result_plan *plan;
+  CassIterator *iterator;
+  size_t position;
+  size_t count;
+} php_driver_result_cursor;
+
+php_driver_result_cursor *php_driver_result_cursor_new(php_driver_ref *result,
+                                                       const php_driver_result_options *options TSRMLS_DC);
+void php_driver_result_cursor_free(php_driver_result_cursor *cursor TSRMLS_DC);
+const CassRow *php_driver_result_cursor_seek(php_driver_result_cursor *cursor, size_t index);
 
 
 #endif /* PHP_DRIVER_RESULT_H */
@@ -140,4 +140,29 @@ class CollectionIntegrationTest extends CollectionsIntegrationTest
         $this->createTableInsertAndVerifyValueByIndex($listType, null);
         $this->createTableInsertAndVerifyValueByName($listType, null);
     }
+
+    /**
+     * Bind statement with a list of sets modified after being bound
+     *
+     * This test ensures that a list is encoded again when one of its elements
+     * is modified.
+     *
+     * @test
+     */
+    public function testNestedModifiedAfterBinding() {
+        $listType = Type::collection(Type::set(Type::int()));
+        $tableName = $this->createTable($listType);
+
+        $set = Type::set(Type::int())->create(1, 2);
+        $list = $listType->create($set);
+        $this->insertValue($tableName, array("arguments" => array("key1", $list)));
+
+        $set->add(3);
+        $this->insertValue($tableName, array("arguments" => array("key2", $list)));
+
+        $this->verifyValue($tableName, $listType, "key1",
+                           $listType->create(Type::set(Type::int())->create(1, 2)));
+        $this->verifyValue($tableName, $listType, "key2",
+                           $listType->create(Type::set(Type::int())->create(1, 2, 3)));
+    }
 }
@@ -38,6 +38,30 @@ class DatatypeIntegrationTest extends DatatypeIntegrationTests {
         }
     }
 
+    /**
+     * Prepared scalar data types
+     *
+     * This test ensures that values bound to prepared statements using the
+     * binders chosen from the parameter types round trip for all Cassandra's
+     * scalar types.
+     *
+     * @test
+     * @dataProvider dataTypes
+     */
+    public function testPreparedDataTypes($type, $values) {
+        $tableName = $this->createTable($type);
+        $insert = $this->session->prepareAsync(
+            "INSERT INTO $tableName (key, value) VALUES (?, ?)"
+        )->get();
+
+        foreach ($values as $i => $value) {
+            $this->session->execute($insert, array(
+                "arguments" => array("key$i", $value)
+            ));
+            $this->verifyValue($tableName, $type, "key$i", $value);
+        }
+    }
+
     /**
      * Data provider scalar data types
      */
@@ -103,4 +127,148 @@ class DatatypeIntegrationTest extends DatatypeIntegrationTests {
             $this->assertEquals($values[2], $row["value_varint"]);
         }
     }
+
+    /**
+     * Native type decoding
+     *
+     * This test ensures that scalar values are decoded as PHP integers,
+     * floats and strings when the native_types execution option is enabled.
+     *
+     * @test
+     */
+    public function testNativeTypes() {
+        $this->session->execute(
+            "CREATE TABLE {$this->tableNamePrefix} " .
+            "(key uuid PRIMARY KEY, value_bigint bigint, value_smallint smallint, " .
+            "value_tinyint tinyint, value_float float, value_timestamp timestamp, " .
+            "value_date date, value_time time, value_inet inet, value_timeuuid timeuuid)"
+        );
+
+        $key = new Uuid("03398c99-c635-4fad-b30a-3b2c49f785c2");
+        $timeuuid = new Timeuuid(0);
+        $this->session->execute(
+            "INSERT INTO {$this->tableNamePrefix} (key, value_bigint, value_smallint, " .
+            "value_tinyint, value_float, value_timestamp, value_date, value_time, " .
+            "value_inet, value_timeuuid) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?)",
+            array("arguments" => array(
+                $key, new Bigint("1234567890123"), new Smallint(74), new Tinyint(37),
+                new Float(2.5), new Timestamp(123, 0), new Date(86400),
+                new Time(1234567890), new Inet("127.0.0.1"), $timeuuid
+            ))
+        );
+
+        $rows = $this->session->execute(
+            "SELECT * FROM {$this->tableNamePrefix}",
+            array("native_types" => true)
+        );
+        $row = $rows->first();
+
+        $this->assertSame("03398c99-c635-4fad-b30a-3b2c49f785c2", $row["key"]);
+        $this->assertSame(1234567890123, $row["value_bigint"]);
+        $this->assertSame(74, $row["value_smallint"]);
+        $this->assertSame(37, $row["value_tinyint"]);
+        $this->assertSame(2.5, $row["value_float"]);
+        $this->assertSame(123000, $row["value_timestamp"]);
+        $this->assertSame(86400, $row["value_date"]);
+        $this->assertSame(1234567890, $row["value_time"]);
+        $this->assertSame("127.0.0.1", $row["value_inet"]);
+        $this->assertSame($timeuuid->uuid(), $row["value_timeuuid"]);
+    }
+
+    /**
+     * Native values bound to prepared statements
+     *
+     * This test ensures that native PHP values are converted using the types
+     * of a prepared statement's parameters.
+     *
+     * @test
+     */
+    public function testPreparedNativeValues() {
+        $this->session->execute(
+            "CREATE TABLE {$this->tableNamePrefix} " .
+            "(key uuid PRIMARY KEY, value_bigint bigint, value_smallint smallint, " .
+            "value_tinyint tinyint, value_timestamp timestamp, value_varint varint, " .
+            "value_decimal decimal, value_timeuuid timeuuid, value_list list<bigint>, " .
+            "value_set set<uuid>, value_map map<text, decimal>)"
+        );
+
+        $timeuuid = new Timeuuid(0);
+        $insert = $this->session->prepare(
+            "INSERT INTO {$this->tableNamePrefix} (key, value_bigint, value_smallint, " .
+            "value_tinyint, value_timestamp, value_varint, value_decimal, value_timeuuid, " .
+            "value_list, value_set, value_map) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)"
+        );
+        $this->session->execute($insert, array("arguments" => array(
+            "03398c99-c635-4fad-b30a-3b2c49f785c2",
+            1234567890123,
+            -74,
+            37,
+            123000,
+            "-170141183460469231731687303715884105728",
+            "3.14159",
+            hex2bin(str_replace("-", "", $timeuuid->uuid())),
+            array(1, -1, 128),
+            array("a7d1f4ab-7f3e-4a4e-9b48-4b4b8e1dc6c8"),
+            array("pi" => "3.14", "1" => 1)
+        )));
+
+        $rows = $this->session->execute(
+            "SELECT * FROM {$this->tableNamePrefix}"
+        );
+        $row = $rows->first();
+
+        $this->assertEquals(new Uuid("03398c99-c635-4fad-b30a-3b2c49f785c2"), $row["key"]);
+        $this->assertEquals(new Bigint("1234567890123"), $row["value_bigint"]);
+        $this->assertEquals(new Smallint(-74), $row["value_smallint"]);
+        $this->assertEquals(new Tinyint(37), $row["value_tinyint"]);
+        $this->assertEquals(new Timestamp(123, 0), $row["value_timestamp"]);
+        $this->assertEquals(new Varint("-170141183460469231731687303715884105728"), $row["value_varint"]);
+        $this->assertEquals(new Decimal("3.14159"), $row["value_decimal"]);
+        $this->assertEquals($timeuuid, $row["value_timeuuid"]);
+        $this->assertEquals(
+            Type::collection(Type::bigint())->create(new Bigint(1), new Bigint(-1), new Bigint(128)),
+            $row["value_list"]
+        );
+        $this->assertEquals(
+            Type::set(Type::uuid())->create(new Uuid("a7d1f4ab-7f3e-4a4e-9b48-4b4b8e1dc6c8")),
+            $row["value_set"]
+        );
+        $this->assertEquals(
+            Type::map(Type::text(), Type::decimal())->create(
+                "1", new Decimal("1"), "pi", new Decimal("3.14")
+            ),
+            $row["value_map"]
+        );
+    }
+
+    /**
+     * Native integers bound to int and float parameters
+     *
+     * This test ensures that integers are range checked for int parameters
+     * and converted for float parameters.
+     *
+     * @test
+     */
+    public function testPreparedNativeIntegers() {
+        $this->session->execute(
+            "CREATE TABLE {$this->tableNamePrefix} " .
+            "(key int PRIMARY KEY, value_float float)"
+        );
+
+        $insert = $this->session->prepare(
+            "INSERT INTO {$this->tableNamePrefix} (key, value_float) VALUES (?, ?)"
+        );
+        $this->session->execute($insert, array("arguments" => array(2147483647, 3)));
+
+        $row = $this->session->execute("SELECT * FROM {$this->tableNamePrefix}")->first();
+        $this->assertEquals(2147483647, $row["key"]);
+        $this->assertEquals(new Float(3), $row["value_float"]);
+
+        try {
+            $this->session->execute($insert, array("arguments" => array(2147483648, 3)));
+            $this->fail("Bound an integer out of the range of an int");
+        } catch (Exception\RangeException $e) {
+            $this->assertTrue(true);
+        }
+    }
 }
@@ -317,4 +317,188 @@ class PagingIntegrationTest extends BasicIntegrationTest {
         $count = $this->validatePageResults($rows);
         $this->assertEquals($totalInserts, $count);
     }
+
+    /**
+     * Lazily decoded rows
+     *
+     * This test ensures that rows decoded on demand are the same as the rows
+     * decoded eagerly, regardless of the order they are accessed in, and that
+     * subsequent pages are decoded lazily as well.
+     *
+     * @test
+     */
+    public function testLazyRows() {
+        $query = "SELECT * FROM {$this->tableNamePrefix}";
+        $eager = $this->session->execute($query);
+        $lazy = $this->session->execute($query, array("lazy" => true));
+
+        $this->assertEquals(10, $lazy->count());
+        $this->assertEquals($eager[9], $lazy[9]);
+        $this->assertEquals($eager[0], $lazy->first());
+        $this->assertTrue(isset($lazy[9]));
+        $this->assertFalse(isset($lazy[10]));
+        $this->assertNull($lazy[10]);
+
+        $keys = array();
+        foreach ($lazy as $key => $row) {
+            $keys[] = $key;
+            $this->assertEquals($eager[$key], $row);
+        }
+        $this->assertEquals(range(0, 9), $keys);
+
+        $rows = $this->session->execute($query, array("page_size" => 3, "lazy" => true));
+        $values = self::convertRowsToArray($rows, "value");
+        while (!$rows->isLastPage()) {
+            $rows = $rows->nextPage();
+            $values = array_merge($values, self::convertRowsToArray($rows, "value"));
+        }
+        sort($values);
+        $this->assertEquals(range(0, 9), $values);
+    }
+
+    /**
+     * Row objects and column projection
+     *
+     * This test ensures that row objects decode the same values as array rows,
+     * that only the projected columns are decoded and that an unknown column
+     * in the projection is rejected.
+     *
+     * @test
+     */
+    public function testRowObjectsWithProjection() {
+        $query = "SELECT * FROM {$this->tableNamePrefix}";
+        $eager = $this->session->execute($query);
+        $rows = $this->session->execute($query, array("row_objects" => true));
+
+        $this->assertEquals(10, $rows->count());
+        foreach ($rows as $key => $row) {
+            $this->assertInstanceOf('Cassandra\Row', $row);
+            $this->assertEquals(2, count($row));
+            $this->assertEquals($eager[$key]["value"], $row["value"]);
+            $this->assertEquals($eager[$key]["key"], $row->key);
+            $this->assertEquals($eager[$key]["value"], $row[1]);
+            $this->assertEquals($eager[$key], $row->toArray());
+        }
+
+        $rows = $this->session->execute($query, array("columns" => array("value")));
+        foreach ($rows as $key => $row) {
+            $this->assertEquals(array("value" => $eager[$key]["value"]), $row);
+        }
+
+        try {
+            $this->session->execute($query, array("columns" => array("missing")));
+            $this->fail("Expected an exception for an unknown column");
+        } catch (\Cassandra\Exception\InvalidArgumentException $e) {
+            $this->assertContains("missing", $e->getMessage());
+        }
+    }
+
+    /**
+     * Fetch styles
+     *
+     * This test ensures that rows are shaped according to the fetch style
+     * requested in the execution options.
+     *
+     * @test
+     */
+    public function testFetchStyles() {
+        $query = "SELECT key, value FROM {$this->tableNamePrefix}";
+        $eager = $this->session->execute($query);
+
+        $rows = $this->session->execute($query, array("fetch_style" => \Cassandra::FETCH_NUM));
+        foreach ($rows as $i => $row) {
+            $this->assertSame(array($eager[$i]["key"], $eager[$i]["value"]), $row);
+        }
+
+        $rows = $this->session->execute($query, array(
+            "fetch_style" => \Cassandra::FETCH_COLUMN,
+            "fetch_column" => 1
+        ));
+        foreach ($rows as $i => $value) {
+            $this->assertSame($eager[$i]["value"], $value);
+        }
+
+        $rows = $this->session->execute($query, array("fetch_style" => \Cassandra::FETCH_KEY_PAIR));
+        $this->assertEquals(10, $rows->count());
+        foreach ($eager as $row) {
+            $this->assertSame($row["value"], $rows[$row["key"]]);
+        }
+
+        $rows = $this->session->execute($query, array("fetch_style" => \Cassandra::FETCH_GROUP));
+        foreach ($eager as $row) {
+            $this->assertSame(array(array("value" => $row["value"])), $rows[$row["key"]]);
+        }
+
+        $rows = $this->session->execute("SELECT key, cluster_name FROM system.local",
+                                        array("fetch_style" => \Cassandra::FETCH_KEY_PAIR));
+        foreach ($rows as $key => $value) {
+            $this->assertSame("local", $key);
+        }
+    }
+
+    /**
+     * Fetch styles keyed by a column that can't be an array key
+     *
+     * This test ensures that the key column is checked before the page is
+     * decoded.
+     *
+     * @test
+     * @expectedException \Cassandra\Exception\InvalidArgumentException
+     */
+    public function testFetchStyleInvalidKey() {
+        $this->session->execute("SELECT tokens, key FROM system.local",
+                                array("fetch_style" => \Cassandra::FETCH_KEY_PAIR));
+    }
+
+    /**
+     * Columnar rows
+     *
+     * This test ensures that the columns of a page are the same whether they
+     * are decoded directly or built from the rows of the page.
+     *
+     * @test
+     */
+    public function testColumnarRows() {
+        $query = "SELECT key, value FROM {$this->tableNamePrefix}";
+        $eager = $this->session->execute($query);
+        $columns = $eager->columns();
+
+        $this->assertEquals(array("key", "value"), array_keys($columns));
+        foreach ($eager as $i => $row) {
+            $this->assertSame($row["key"], $columns["key"][$i]);
+            $this->assertSame($row["value"], $columns["value"][$i]);
+        }
+
+        $rows = $this->session->execute($query, array("columnar" => true));
+        $this->assertEquals($columns, $rows->columns());
+        $this->assertEquals(10, $rows->count());
+
+        $rows = $this->session->execute($query, array(
+            "columnar" => true,
+            "fetch_style" => \Cassandra::FETCH_NUM
+        ));
+        $this->assertEquals(array_values($columns), $rows->columns());
+    }
+
+    /**
+     * Streamed rows
+     *
+     * This test ensures that a row stream yields the rows of all pages in
+     * order, with or without prefetching the next page.
+     *
+     * @test
+     */
+    public function testStreamRows() {
+        $query = "SELECT * FROM {$this->tableNamePrefix}";
+        $eager = $this->session->execute($query);
+
+        foreach (array(true, false) as $prefetch) {
+            $rows = $this->session->execute($query, array("page_size" => 3));
+            $streamed = array();
+            foreach ($rows->stream($prefetch) as $key => $row) {
+                $streamed[$key] = $row;
+            }
+            $this->assertEquals(iterator_to_array($eager), $streamed);
+        }
+    }
 }
@@ -51,4 +51,295 @@ class SessionIntegrationTest extends BasicIntegrationTest {
         $this->ccm->start();
 
     }
+
+    /**
+     * Prepared statements of persistent sessions are cached
+     *
+     * This test will ensure that statements prepared with persistent sessions
+     * are reused within the keyspace they were prepared in.
+     *
+     * @test_category prepared_statements
+     * @expected_result Cached prepared statements execute in their keyspace
+     */
+    public function testPersistentPreparedStatements() {
+        $this->session->execute("CREATE TABLE {$this->tableNamePrefix} (key int PRIMARY KEY)");
+
+        $cluster = \Cassandra::cluster()
+            ->withContactPoints(Integration::IP_ADDRESS)
+            ->withPersistentSessions(true)
+            ->build();
+        $session = $cluster->connect();
+
+        $session->execute("USE system");
+        $first = $session->prepare("SELECT key FROM local");
+        $second = $session->prepare("SELECT key FROM local");
+        $async = $session->prepareAsync("SELECT key FROM local")->get();
+        foreach (array($first, $second, $async) as $prepared) {
+            $this->assertCount(1, $session->execute($prepared));
+        }
+
+        // The same query targets another table in another keyspace
+        $session->execute("USE {$this->keyspaceName}");
+        $prepared = $session->prepare("SELECT key FROM {$this->tableNamePrefix}");
+        $this->assertCount(0, $session->execute($prepared));
+        try {
+            $session->prepare("SELECT key FROM local");
+            $this->fail("Prepared a query from another keyspace");
+        } catch (Exception\InvalidQueryException $e) {
+            $this->assertTrue(true);
+        }
+
+        $session->execute("USE system");
+    }
+
+    /**
+     * Cached prepared statements follow the keyspace of USE queries
+     *
+     * This test will ensure that the cache only switches keyspace once a USE
+     * query succeeded, whether it was executed as a simple or a prepared
+     * statement.
+     *
+     * @test_category prepared_statements
+     * @expected_result Cached prepared statements execute in their keyspace
+     */
+    public function testPersistentPreparedStatementsUse() {
+        $this->session->execute("CREATE TABLE {$this->tableNamePrefix} (key int PRIMARY KEY)");
+
+        $cluster = \Cassandra::cluster()
+            ->withContactPoints(Integration::IP_ADDRESS)
+            ->withPersistentSessions(true)
+            ->build();
+        $session = $cluster->connect($this->keyspaceName);
+        $query = "SELECT key FROM {$this->tableNamePrefix}";
+        $this->assertCount(0, $session->execute($session->prepare($query)));
+
+        // A USE query that fails keeps the session in its keyspace
+        try {
+            $session->execute("USE {$this->keyspaceName}_missing");
+            $this->fail("Switched to a keyspace that doesn't exist");
+        } catch (Exception\InvalidQueryException $e) {
+            $this->assertTrue(true);
+        }
+        $this->assertCount(0, $session->execute($session->prepare($query)));
+
+        // A prepared USE query switches the keyspace of the cache too
+        $session->execute($session->prepare("USE system"));
+        try {
+            $session->prepare($query);
+            $this->fail("Prepared a query from another keyspace");
+        } catch (Exception\InvalidQueryException $e) {
+            $this->assertTrue(true);
+        }
+        $this->assertCount(1, $session->execute($session->prepare("SELECT key FROM local")));
+
+        $session->execute("USE {$this->keyspaceName}");
+    }
+
+    /**
+     * Simple statements executed past the threshold keep working once their
+     * query is prepared in the background.
+     */
+    public function testAutoPrepare() {
+        $this->session->execute("CREATE TABLE {$this->tableNamePrefix} (key int PRIMARY KEY, value text)");
+
+        $cluster = \Cassandra::cluster()
+            ->withContactPoints(Integration::IP_ADDRESS)
+            ->withAutoPrepare(2)
+            ->build();
+        $session = $cluster->connect($this->keyspaceName);
+
+        $insert = "INSERT INTO {$this->tableNamePrefix} (key, value) VALUES (?, ?)";
+        for ($i = 0; $i < 100; $i++) {
+            $session->execute($insert, array('arguments' => array($i, "value{$i}")));
+        }
+
+        $select = "SELECT value FROM {$this->tableNamePrefix} WHERE key = ?";
+        for ($i = 0; $i < 100; $i++) {
+            $rows = $session->execute($select, array('arguments' => array($i)));
+            $this->assertEquals("value{$i}", $rows->first()['value']);
+        }
+    }
+
+    /**
+     * @expectedException \Cassandra\Exception\InvalidArgumentException
+     */
+    public function testAutoPrepareInvalidThreshold() {
+        \Cassandra::cluster()->withAutoPrepare(0);
+    }
+
+    /**
+     * Preloaded sessions and prepared statements are the ones later
+     * connections use.
+     */
+    public function testPreload() {
+        $this->session->execute("CREATE TABLE {$this->tableNamePrefix} (key int PRIMARY KEY)");
+
+        $cluster = \Cassandra::cluster()
+            ->withContactPoints(Integration::IP_ADDRESS)
+            ->withPersistentSessions(true)
+            ->build();
+        $query = "SELECT key FROM {$this->tableNamePrefix}";
+        $cluster->preload(array($this->keyspaceName => array($query)));
+        $cluster->preload(array($this->keyspaceName => array($query)));
+
+        $session = $cluster->connect($this->keyspaceName);
+        $this->assertCount(0, $session->execute($session->prepare($query)));
+    }
+
+    /**
+     * @expectedException \Cassandra\Exception\InvalidArgumentException
+     */
+    public function testPreloadInvalidQueries() {
+        \Cassandra::cluster()
+            ->withContactPoints(Integration::IP_ADDRESS)
+            ->build()
+            ->preload(array($this->keyspaceName => "SELECT key FROM local"));
+    }
+
+    /**
+     * Executions select the profiles registered on the cluster, and the
+     * options they set override the profile's.
+     */
+    public function testExecutionProfiles() {
+        $this->session->execute("CREATE TABLE {$this->tableNamePrefix} (key int PRIMARY KEY)");
+
+        $cluster = \Cassandra::cluster()
+            ->withContactPoints(Integration::IP_ADDRESS)
+            ->withExecutionProfile('all', array('consistency' => \Cassandra::CONSISTENCY_ALL, 'timeout' => 5))
+            ->build();
+        $session = $cluster->connect($this->keyspaceName);
+
+        $session->execute("INSERT INTO {$this->tableNamePrefix} (key) VALUES (?)", array(
+            'profile' => 'all',
+            'arguments' => array(1)
+        ));
+        $rows = $session->execute("SELECT key FROM {$this->tableNamePrefix}", array(
+            'profile' => 'all',
+            'consistency' => \Cassandra::CONSISTENCY_ONE
+        ));
+        $this->assertCount(1, $rows);
+
+        try {
+            $session->execute("SELECT key FROM {$this->tableNamePrefix}", array('profile' => 'missing'));
+            $this->fail("Executed with a profile that wasn't registered");
+        } catch (Exception $e) {
+            $this->assertTrue(true);
+        }
+    }
+
+    /**
+     * @expectedException \Cassandra\Exception\InvalidArgumentException
+     */
+    public function testExecutionProfileInvalidOptions() {
+        \Cassandra::cluster()->withExecutionProfile('invalid', array('consistency' => 'none'));
+    }
+
+    /**
+     * The deadline of an execution is shared by the pages fetched after it.
+     */
+    public function testDeadline() {
+        $this->session->execute("CREATE TABLE {$this->tableNamePrefix} (key int PRIMARY KEY)");
+        for ($i = 0; $i < 3; $i++) {
+            $this->session->execute("INSERT INTO {$this->tableNamePrefix} (key) VALUES (?)",
+                                    array('arguments' => array($i)));
+        }
+
+        $rows = $this->session->execute("SELECT key FROM {$this->tableNamePrefix}", array(
+            'page_size' => 1,
+            'deadline' => 30
+        ));
+        $count = count($rows);
+        while (!$rows->isLastPage()) {
+            $rows = $rows->nextPage();
+            $count += count($rows);
+        }
+        $this->assertEquals(3, $count);
+
+        $rows = $this->session->execute("SELECT key FROM {$this->tableNamePrefix}", array(
+            'page_size' => 1,
+            'deadline' => 0.5
+        ));
+        usleep(600000);
+        try {
+            $rows->nextPage();
+            $this->fail("Fetched a page after the deadline passed");
+        } catch (\Cassandra\Exception\TimeoutException $e) {
+            $this->assertTrue(true);
+        }
+    }
+
+    /**
+     * Cancelled futures don't resolve, only the futures of executions can be
+     * cancelled.
+     */
+    public function testCancel() {
+        $prepared = $this->session->prepareAsync("SELECT * FROM system.local");
+        $this->assertFalse($prepared->cancel());
+        $this->assertInstanceOf("Cassandra\\PreparedStatement", $prepared->get());
+
+        $future = $this->session->executeAsync("SELECT * FROM system.local");
+        if (!$future->cancel()) {
+            $this->markTestSkipped("The execution completed before it was cancelled");
+        }
+        $this->assertFalse($future->cancel());
+
+        try {
+            $future->get();
+            $this->fail("Resolved a cancelled future");
+        } catch (\Cassandra\Exception\RuntimeException $e) {
+            $this->assertTrue(true);
+        }
+    }
+
+    /**
+     * Sessions use the default timeout of their cluster, which also bounds
+     * the request timeout of their executions.
+     */
+    public function testDefaultTimeout() {
+        $session = \Cassandra::cluster()
+            ->withContactPoints(Integration::IP_ADDRESS)
+            ->withDefaultTimeout(0.001)
+            ->build()
+            ->connect();
+
+        $rows = $session->execute("SELECT * FROM system_schema.columns", array('timeout' => 30));
+        $this->assertGreaterThan(0, count($rows));
+
+        try {
+            $session->execute("SELECT * FROM system_schema.columns");
+        } catch (\Cassandra\Exception\TimeoutException $e) {
+            return;
+        }
+        $this->markTestSkipped("The execution completed within the default timeout");
+    }
+
+    /**
+     * The default timeout of a session doesn't override the request timeout
+     * of the execution profile.
+     */
+    public function testDefaultTimeoutProfile() {
+        $session = \Cassandra::cluster()
+            ->withContactPoints(Integration::IP_ADDRESS)
+            ->withDefaultTimeout(30)
+            ->withExecutionProfile('short', array('timeout' => 0.001))
+            ->build()
+            ->connect();
+
+        $rows = $session->execute("SELECT * FROM system_schema.columns");
+        $this->assertGreaterThan(0, count($rows));
+
+        try {
+            $session->execute("SELECT * FROM system_schema.columns", array('profile' => 'short'));
+        } catch (\Cassandra\Exception\TimeoutException $e) {
+            return;
+        }
+        $this->markTestSkipped("The execution completed within the profile's request timeout");
+    }
+
+    /**
+     * @expectedException \Cassandra\Exception\InvalidArgumentException
+     */
+    public function testDeadlineInvalid() {
+        $this->session->execute("SELECT * FROM system.local", array('deadline' => 0));
+    }
 }
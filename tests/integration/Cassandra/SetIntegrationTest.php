@@ -145,4 +145,29 @@ class SetIntegrationTest extends CollectionsIntegrationTest
         $this->createTableInsertAndVerifyValueByIndex($setType, null);
         $this->createTableInsertAndVerifyValueByName($setType, null);
     }
+
+    /**
+     * Bind statement with a set modified after being bound
+     *
+     * This test ensures that the encoding kept by a set after being bound is
+     * not reused once the set is modified.
+     *
+     * @test
+     */
+    public function testModifiedAfterBinding() {
+        $setType = Type::set(Type::varint());
+        $tableName = $this->createTable($setType);
+
+        $set = $setType->create(new Varint("1"), new Varint("-170141183460469231731687303715884105728"));
+        $this->insertValue($tableName, array("arguments" => array("key1", $set)));
+        $this->insertValue($tableName, array("arguments" => array("key2", $set)));
+        $first = $setType->create(new Varint("1"), new Varint("-170141183460469231731687303715884105728"));
+
+        $set->add(new Varint("2"));
+        $this->insertValue($tableName, array("arguments" => array("key3", $set)));
+
+        $this->verifyValue($tableName, $setType, "key1", $first);
+        $this->verifyValue($tableName, $setType, "key2", $first);
+        $this->verifyValue($tableName, $setType, "key3", $set);
+    }
 }
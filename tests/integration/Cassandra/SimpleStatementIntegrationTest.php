@@ -294,4 +294,274 @@ class SimpleStatementIntegrationTest extends BasicIntegrationTest {
         $this->assertNull($row["value_int"]);
         $this->assertNull($row["value_boolean"]);
     }
+
+    /**
+     * Prepared statements support named parameters for queries.
+     *
+     * This test will ensure that the PHP driver binds named parameters of a
+     * prepared statement to the right column whether or not the names are
+     * lowercased, mixed case or quoted.
+     *
+     * @test
+     *
+     * @cassandra-version-2.1
+     * @cpp-driver-version-2.2.3
+     */
+    public function testPreparedByName() {
+        // Determine if the test should be skipped
+        if (version_compare(\Cassandra::CPP_DRIVER_VERSION, "2.2.3") < 0) {
+            $this->markTestSkipped("Skipping {$this->getName()}: Case sensitivity issue fixed in DataStax C/C++ v 2.2.3");
+        }
+
+        // Create the table
+        $this->session->execute(
+            "CREATE TABLE {$this->tableNamePrefix} " .
+            "(key int PRIMARY KEY, value_int int, value_text text)"
+        );
+
+        // Insert the values using the different forms of names
+        $statement = $this->session->prepare(
+            "INSERT INTO {$this->tableNamePrefix} " .
+            "(key, value_int, value_text) VALUES (?, ?, ?)"
+        );
+        $this->session->execute($statement, array("arguments" => array(
+            "value_text" => "Lowercase",
+            "value_int" => 1,
+            "key" => 1
+        )));
+        $this->session->execute($statement, array("arguments" => array(
+            "KEY" => 2,
+            "\"value_int\"" => 2,
+            "Value_Text" => "Mixed case"
+        )));
+
+        // Select and assert the values
+        $select = $this->session->prepare("SELECT * FROM {$this->tableNamePrefix} WHERE key = ?");
+        $row = $this->session->execute($select, array("arguments" => array("key" => 1)))->first();
+        $this->assertEquals(1, $row["value_int"]);
+        $this->assertEquals("Lowercase", $row["value_text"]);
+        $row = $this->session->execute($select, array("arguments" => array("key" => 2)))->first();
+        $this->assertEquals(2, $row["value_int"]);
+        $this->assertEquals("Mixed case", $row["value_text"]);
+    }
+
+    /**
+     * Bound statement executed repeatedly
+     *
+     * This test will ensure that the PHP driver executes a bound statement
+     * more than once, keeping the arguments that aren't set again, including
+     * while the rows of a previous execution are still being paged.
+     *
+     * @test
+     */
+    public function testBoundStatement() {
+        // Create the table
+        $this->session->execute(
+            "CREATE TABLE {$this->tableNamePrefix} " .
+            "(key int, id int, value text, PRIMARY KEY (key, id))"
+        );
+
+        // Insert the values only changing the clustering column
+        $bound = $this->session->prepare(
+            "INSERT INTO {$this->tableNamePrefix} (key, id, value) VALUES (?, ?, ?)"
+        )->bind(array("key" => 1, "value" => "Bound"));
+        for ($id = 0; $id < 10; $id++) {
+            $this->assertSame($bound, $bound->set(1, $id));
+            $this->session->execute($bound);
+        }
+        $this->session->execute($bound->set("VALUE", "Last"));
+
+        // Page through the rows while the statement is executed again
+        $select = $this->session->prepare("SELECT * FROM {$this->tableNamePrefix} WHERE key = ?")
+                                ->bind(array(1));
+        $rows = $this->session->execute($select, array("page_size" => 4));
+        $this->assertCount(4, $rows);
+        $this->assertCount(10, $this->session->execute($select));
+        $rows = $rows->nextPage();
+        $this->assertCount(4, $rows);
+        $this->assertEquals(4, $rows->first()["id"]);
+
+        // Arguments of the execution options only apply to that execution
+        $this->assertCount(0, $this->session->execute($select, array("arguments" => array(2))));
+        $rows = $this->session->execute($select);
+        $this->assertCount(10, $rows);
+        foreach ($rows as $id => $row) {
+            $this->assertEquals($id, $row["id"]);
+            $this->assertEquals($id == 9 ? "Last" : "Bound", $row["value"]);
+        }
+    }
+
+    /**
+     * Executing a statement for many rows of arguments
+     *
+     * This test will ensure that the PHP driver executes a statement for each
+     * row of arguments with a bounded number of executions in flight,
+     * returning the results in the order of the rows and reporting the
+     * failure of a row without stopping the others.
+     *
+     * @test
+     */
+    public function testExecuteMany() {
+        // Create the table
+        $this->session->execute(
+            "CREATE TABLE {$this->tableNamePrefix} " .
+            "(key int PRIMARY KEY, value text)"
+        );
+
+        // Insert the rows from a generator, one of them is invalid
+        $rows = function () {
+            for ($key = 0; $key < 50; $key++) {
+                yield "row{$key}" => array($key, "Value {$key}");
+            }
+            yield "invalid" => array("key", "Invalid");
+        };
+        $insert = $this->session->prepare(
+            "INSERT INTO {$this->tableNamePrefix} (key, value) VALUES (?, ?)"
+        );
+        $results = $this->session->executeMany($insert, $rows(), array("concurrency" => 8));
+        $this->assertCount(51, $results);
+        $this->assertEquals("row0", key($results));
+        $this->assertInstanceOf("Cassandra\\Rows", $results["row49"]);
+        $this->assertInstanceOf("Cassandra\\Exception\\InvalidArgumentException", $results["invalid"]);
+
+        // Select the rows through a callback
+        $values = array();
+        $select = $this->session->prepare("SELECT value FROM {$this->tableNamePrefix} WHERE key = ?");
+        $keys = array_map(function ($key) { return array($key); }, range(0, 49));
+        $this->assertNull($this->session->executeMany($select, $keys, array(
+            "concurrency" => 4,
+            "callback" => function ($rows, $key) use (&$values) {
+                $values[$key] = $rows->first()["value"];
+            }
+        )));
+        $this->assertCount(50, $values);
+        $this->assertEquals("Value 42", $values[42]);
+    }
+
+    /**
+     * Executing a statement for rows that throw
+     *
+     * This test will ensure that the PHP driver rethrows the exception of
+     * rows that throw partway through instead of reporting it as the result
+     * of an execution.
+     *
+     * @test
+     */
+    public function testExecuteManyRowsThrow() {
+        $rows = function () {
+            for ($key = 0; $key < 10; $key++) {
+                yield array();
+            }
+            throw new \RuntimeException("Rows failed");
+        };
+        $results = array();
+
+        try {
+            $this->session->executeMany("SELECT * FROM system.local", $rows(), array(
+                "concurrency" => 4,
+                "callback" => function ($rows, $key) use (&$results) {
+                    $results[$key] = $rows;
+                }
+            ));
+            $this->fail("The exception of the rows wasn't rethrown");
+        } catch (\RuntimeException $e) {
+            $this->assertEquals("Rows failed", $e->getMessage());
+        }
+        foreach ($results as $result) {
+            $this->assertInstanceOf("Cassandra\\Rows", $result);
+        }
+    }
+
+    /**
+     * Waiting on many futures at once
+     *
+     * This test will ensure that the PHP driver waits on many futures at once
+     * and returns them with their keys as they complete.
+     *
+     * @test
+     */
+    public function testWaitOnFutures() {
+        $futures = array();
+        for ($i = 0; $i < 20; $i++) {
+            $futures["select{$i}"] = $this->session->executeAsync(
+                "SELECT * FROM system.local"
+            );
+        }
+
+        $this->assertInstanceOf("Cassandra\\FutureRows", Futures::any($futures));
+        $this->assertGreaterThanOrEqual(1, count(Futures::select($futures, 10)));
+
+        $completed = Futures::all($futures, 10);
+        $this->assertCount(20, $completed);
+        foreach ($completed as $key => $future) {
+            $this->assertSame($futures[$key], $future);
+            $this->assertCount(1, $future->get());
+        }
+    }
+
+    /**
+     * Awaiting futures from fibers
+     *
+     * This test ensures that futures awaited from fibers suspend them until
+     * the scheduler resumes them with their results.
+     *
+     * @test
+     * @requires PHP 8.1
+     */
+    public function testAwaitInFibers() {
+        $counts = array();
+        for ($i = 0; $i < 10; $i++) {
+            $session = $this->session;
+            $fiber = new \Fiber(function () use ($session, $i, &$counts) {
+                $rows = $session->executeAsync("SELECT * FROM system.local")->await(10);
+                $counts[$i] = count($rows);
+            });
+            $fiber->start();
+        }
+
+        $this->assertTrue(Scheduler::run(10));
+        $this->assertCount(10, $counts);
+        $this->assertEquals(array_fill(0, 10, 1), $counts);
+
+        // Blocks outside of fibers
+        $this->assertCount(1, $this->session->executeAsync("SELECT * FROM system.local")->await());
+    }
+
+    /**
+     * Bound statement bound again after an execution timed out
+     *
+     * This test will ensure that the PHP driver doesn't modify a bound
+     * statement in place while a request that timed out is still executing
+     * it.
+     *
+     * @test
+     */
+    public function testBoundStatementAfterTimeout() {
+        // Create the table
+        $this->session->execute(
+            "CREATE TABLE {$this->tableNamePrefix} " .
+            "(key int PRIMARY KEY, value text)"
+        );
+
+        $bound = $this->session->prepare(
+            "INSERT INTO {$this->tableNamePrefix} (key, value) VALUES (?, ?)"
+        )->bind(array(1, "Timed out"));
+        try {
+            $this->session->execute($bound, array("timeout" => 0.000001));
+        } catch (Exception\TimeoutException $e) {
+            // Still in flight
+        }
+
+        // Bind and execute while the first request may still be running
+        $this->session->execute($bound->set(0, 2)->set(1, "Bound again"));
+        $this->session->executeAsync($bound->set(0, 3))->get(10);
+
+        $row = $this->session->execute(
+            "SELECT * FROM {$this->tableNamePrefix} WHERE key = 2"
+        )->first();
+        $this->assertEquals("Bound again", $row["value"]);
+        $this->assertCount(1, $this->session->execute(
+            "SELECT * FROM {$this->tableNamePrefix} WHERE key = 3"
+        ));
+    }
 }
@@ -36,6 +36,18 @@ class BlobTest extends \PHPUnit_Framework_TestCase
         $this->assertEquals("Hi", (string) $blob->toBinaryString());
     }
 
+    public function testIsNotAffectedByChangesToSharedStrings()
+    {
+        $bytes = str_repeat("\x00\xff", 1024);
+        $blob = new Blob($bytes);
+        $bytes[0] = "x";
+
+        $binary = $blob->toBinaryString();
+        $binary[1] = "x";
+
+        $this->assertEquals(str_repeat("\x00\xff", 1024), $blob->toBinaryString());
+    }
+
     /**
      * @dataProvider equalTypes
      */
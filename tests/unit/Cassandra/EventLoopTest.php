@@ -0,0 +1,56 @@
+<?php
+
+/**
+ * Copyright 2017 DataStax, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+namespace Cassandra;
+
+/**
+ * @requires extension cassandra
+ */
+class EventLoopTest extends \PHPUnit_Framework_TestCase
+{
+    public function testDrainsCompletedFutures()
+    {
+        $future = new FutureValue();
+
+        EventLoop::watch($future);
+        $this->assertSame(array($future), EventLoop::drain());
+        $this->assertSame(array(), EventLoop::drain());
+    }
+
+    public function testSignalsTheStream()
+    {
+        if (strtoupper(substr(PHP_OS, 0, 3)) === 'WIN') {
+            $this->markTestSkipped('Notifications are not supported on Windows');
+        }
+
+        $stream = EventLoop::stream();
+        EventLoop::drain();
+
+        $read = array($stream);
+        $write = $except = null;
+        $this->assertEquals(0, stream_select($read, $write, $except, 0));
+
+        EventLoop::watch(new FutureValue());
+        $read = array($stream);
+        $this->assertEquals(1, stream_select($read, $write, $except, 1));
+
+        $this->assertCount(1, EventLoop::drain());
+        $read = array($stream);
+        $this->assertEquals(0, stream_select($read, $write, $except, 0));
+    }
+}
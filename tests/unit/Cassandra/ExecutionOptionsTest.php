@@ -40,7 +40,14 @@ class ExecutionOptionsTest extends \PHPUnit_Framework_TestCase
             'serial_consistency' => \Cassandra::CONSISTENCY_LOCAL_SERIAL,
             'page_size'          => 15000,
             'timeout'            => 15,
-            'arguments'          => array('a', 1, 'b', 2, 'c', 3)
+            'arguments'          => array('a', 1, 'b', 2, 'c', 3),
+            'lazy'               => true,
+            'row_objects'        => true,
+            'native_types'       => true,
+            'columnar'           => true,
+            'fetch_style'        => \Cassandra::FETCH_COLUMN,
+            'fetch_column'       => 2,
+            'columns'            => array('key', 'value')
         ));
 
         $this->assertEquals(\Cassandra::CONSISTENCY_ANY, $options->consistency);
@@ -48,6 +55,13 @@ class ExecutionOptionsTest extends \PHPUnit_Framework_TestCase
         $this->assertEquals(15000, $options->pageSize);
         $this->assertEquals(15, $options->timeout);
         $this->assertEquals(array('a', 1, 'b', 2, 'c', 3), $options->arguments);
+        $this->assertTrue($options->lazy);
+        $this->assertTrue($options->rowObjects);
+        $this->assertTrue($options->nativeTypes);
+        $this->assertTrue($options->columnar);
+        $this->assertEquals(\Cassandra::FETCH_COLUMN, $options->fetchStyle);
+        $this->assertEquals(2, $options->fetchColumn);
+        $this->assertEquals(array('key', 'value'), $options->columns);
     }
 
     public function testReturnsNullValuesWhenRetrievingUndefinedSettingsByName()
@@ -59,5 +73,12 @@ class ExecutionOptionsTest extends \PHPUnit_Framework_TestCase
         $this->assertNull($options->pageSize);
         $this->assertNull($options->timeout);
         $this->assertNull($options->arguments);
+        $this->assertNull($options->lazy);
+        $this->assertNull($options->rowObjects);
+        $this->assertNull($options->nativeTypes);
+        $this->assertNull($options->columnar);
+        $this->assertNull($options->fetchStyle);
+        $this->assertNull($options->fetchColumn);
+        $this->assertNull($options->columns);
     }
 }
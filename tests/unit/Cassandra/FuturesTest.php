@@ -0,0 +1,56 @@
+<?php
+
+/**
+ * Copyright 2017 DataStax, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+namespace Cassandra;
+
+/**
+ * @requires extension cassandra
+ */
+class FuturesTest extends \PHPUnit_Framework_TestCase
+{
+    public function testWaitsOnNoFutures()
+    {
+        $this->assertEquals(array(), Futures::all(array()));
+        $this->assertEquals(array(), Futures::select(array(), 0.1));
+    }
+
+    /**
+     * @expectedException Cassandra\Exception\InvalidArgumentException
+     */
+    public function testAnyRequiresFutures()
+    {
+        Futures::any(array());
+    }
+
+    /**
+     * @expectedException Cassandra\Exception\InvalidArgumentException
+     * @expectedExceptionMessage futures must be an array of instances of Cassandra\Future
+     */
+    public function testOnlyWaitsOnFutures()
+    {
+        Futures::all(array("not a future"));
+    }
+
+    /**
+     * @expectedException Cassandra\Exception\InvalidArgumentException
+     */
+    public function testRequiresAPositiveTimeout()
+    {
+        Futures::all(array(), -1);
+    }
+}